@@ -0,0 +1,380 @@
+//
+// Created by agent on 10/19/2026.
+//
+
+#include "Batch.h"
+#include "MoveMake.h"
+
+namespace Charon {
+    namespace {
+
+        /**
+         * A method to shift every lane of the given vector left
+         * or right by the absolute value of the direction,
+         * according to its sign.
+         *
+         * @param b The vector to shift
+         * @tparam D The direction and amount to shift with
+         */
+        template<Direction D>
+        constexpr Lanes shiftLanes(const Lanes b)
+        { return D > 0 ? b << (int) D : b >> -(int) D; }
+
+        /**
+         * A function to compute the knight attacks of every lane
+         * set-wise, by shifting the knights one and two files
+         * sideways and then two and one ranks up and down.
+         *
+         * @param b the knight bitboards
+         * @return the squares attacked by the given knights
+         */
+        constexpr Lanes knightAttacks(const Lanes b) {
+            const Lanes h1 = shiftLanes<East>(b & NotEastFile) |
+                             shiftLanes<West>(b & NotWestFile),
+                        h2 = ((b & 0x3F3F3F3F3F3F3F3FUL) << 2) |
+                             ((b & 0xFCFCFCFCFCFCFCFCUL) >> 2);
+            return shiftLanes<North>(shiftLanes<North>(h1)) |
+                   shiftLanes<South>(shiftLanes<South>(h1)) |
+                   shiftLanes<North>(h2) | shiftLanes<South>(h2);
+        }
+
+        /**
+         * A function to compute the king attacks of every lane
+         * set-wise.
+         *
+         * @param b the king bitboards
+         * @return the squares attacked by the given kings
+         */
+        constexpr Lanes kingAttacks(const Lanes b) {
+            const Lanes h = b | shiftLanes<East>(b & NotEastFile) |
+                                shiftLanes<West>(b & NotWestFile);
+            return (h | shiftLanes<North>(h) | shiftLanes<South>(h)) ^ b;
+        }
+
+        /**
+         * A function to determine whether all squares represented
+         * by high bits in the given bitboard are safe from enemy
+         * sliders, for a single lane.
+         *
+         * @param destinations the squares to check
+         * @param allPieces    the occupancy to use
+         * @param rooks        the enemy rooks and queens
+         * @param bishops      the enemy bishops and queens
+         * @return             the number of safe squares
+         */
+        inline int safeFromSliders(const uint64_t destinations,
+                                   const uint64_t allPieces,
+                                   const uint64_t rooks,
+                                   const uint64_t bishops) {
+            int count = 0;
+            for (uint64_t d = destinations; d; d &= d - 1) {
+                const int sq = bitScanFwd(d);
+                count += !((attackBoard<Rook>(allPieces, sq) & rooks) |
+                           (attackBoard<Bishop>(allPieces, sq) & bishops));
+            }
+            return count;
+        }
+
+        /**
+         * A function to count the legal moves of the pieces of
+         * the given type for a single lane, without generating
+         * them.
+         *
+         * @tparam PT        the piece type to consider
+         * @param pieceBoard the piece bitboard of the lane
+         * @param allPieces  the occupancy of the lane
+         * @param kingGuard  the king guard of the lane
+         * @param filter     the filter mask to use
+         * @param kingSquare the square of our king
+         * @return           the number of legal moves
+         */
+        template<PieceType PT>
+        inline int countPieceMoves(const uint64_t pieceBoard,
+                                   const uint64_t allPieces,
+                                   const uint64_t kingGuard,
+                                   const uint64_t filter,
+                                   const int kingSquare) {
+            static_assert(PT >= Rook && PT <= Queen);
+            int count = 0;
+
+            // Count moves for free pieces.
+            for (uint64_t n = pieceBoard & ~kingGuard; n; n &= n - 1)
+                count += highBitCount(
+                    attackBoard<PT>(allPieces, bitScanFwd(n)) & filter
+                );
+
+            // Knight pinned pieces are trapped.
+            if (PT == Knight) return count;
+
+            // Count moves for pinned pieces, which must stay
+            // on the pinning ray.
+            for (uint64_t n = pieceBoard & kingGuard; n; n &= n - 1) {
+                const int origin = bitScanFwd(n);
+                count += highBitCount(
+                    attackBoard<PT>(allPieces, origin) & filter &
+                    rayBoard(kingSquare, origin)
+                );
+            }
+            return count;
+        }
+
+        /**
+         * A function to count the legal moves of pinned pawns
+         * for a single lane. Pinned pawns are rare, so their
+         * pushes and captures are checked against the pinning
+         * ray one at a time.
+         *
+         * @tparam A          the alliance to consider
+         * @param pinnedPawns the pinned pawns of the lane
+         * @param empty       the empty squares of the lane
+         * @param enemies     the enemy pieces of the lane,
+         *                    intersected with the check path
+         * @param checkPath   the check path of the lane
+         * @param kingSquare  the square of our king
+         * @return            the number of legal moves
+         */
+        template<Alliance A>
+        inline int countPinnedPawnMoves(const uint64_t pinnedPawns,
+                                        const uint64_t empty,
+                                        const uint64_t enemies,
+                                        const uint64_t checkPath,
+                                        const int kingSquare) {
+            constexpr const Defaults* const x = defaults<A>();
+            int count = 0;
+            for (uint64_t n = pinnedPawns; n; n &= n - 1) {
+                const int o = bitScanFwd(n);
+                const uint64_t pawn = SquareToBitBoard[o],
+                               ray  = rayBoard(kingSquare, o),
+                               p1   = shift<x->up>(pawn) & empty,
+                               p2   = shift<x->up>(p1 & x->pawnJumpSquares)
+                                      & empty,
+                               targets =
+                                   (((p1 | p2) & checkPath) |
+                                   (SquareToPawnAttacks[A][o] & enemies))
+                                   & ray;
+                count += highBitCount(targets) *
+                    (pawn & x->prePromotionMask ? 4 : 1);
+            }
+            return count;
+        }
+
+        /**
+         * A function to count the legal en passant moves for a
+         * single lane. Each candidate capture is made on a copy
+         * of the occupancy and kept only if our king is safe
+         * afterwards, which covers checks, pins and the
+         * horizontal discovered check in one test.
+         *
+         * @tparam A        the alliance to consider
+         * @param batch     the batch of positions
+         * @param lane      the lane to consider
+         * @param kingSquare the square of our king
+         * @return          the number of legal en passant moves
+         */
+        template<Alliance A>
+        inline int countEnPassant(const BoardBatch& batch,
+                                  const int lane,
+                                  const int kingSquare) {
+            constexpr const Alliance us = A, them = ~us;
+            constexpr const Defaults* const x = defaults<us>();
+            const int enPassantSquare = batch.getEpSquare(lane);
+            if (enPassantSquare == NullSQ) return 0;
+
+            const uint64_t eppBoard    = SquareToBitBoard[enPassantSquare],
+                           destBoard   = shift<x->up>(eppBoard),
+                           theirQueens = batch.getPieces<them, Queen>()[lane],
+                           rooks       = batch.getPieces<them, Rook>()[lane]
+                                         | theirQueens,
+                           bishops     = batch.getPieces<them, Bishop>()[lane]
+                                         | theirQueens,
+                           knights     = batch.getPieces<them, Knight>()[lane],
+                           theirPawns  = batch.getPieces<them, Pawn>()[lane]
+                                         ^ eppBoard,
+                           passes      =
+                               (shift<x->right>(eppBoard & x->notRightCol) |
+                                shift<x->left >(eppBoard & x->notLeftCol )) &
+                               batch.getPieces<us, Pawn>()[lane];
+
+            int count = 0;
+            for (uint64_t p = passes; p; p &= p - 1) {
+                const uint64_t o   = p & (uint64_t) -(int64_t) p,
+                               occ = (batch.getAllPieces()[lane] ^ o ^
+                                      eppBoard) | destBoard;
+                if (!((attackBoard<Rook>(occ, kingSquare) & rooks)      |
+                      (attackBoard<Bishop>(occ, kingSquare) & bishops)  |
+                      (SquareToKnightAttacks[kingSquare] & knights)     |
+                      (SquareToPawnAttacks[us][kingSquare] & theirPawns)))
+                    ++count;
+            }
+            return count;
+        }
+
+        /**
+         * A function to count the legal moves of every position
+         * in the given batch.
+         *
+         * @tparam A     the alliance to move in every lane
+         * @param batch  the batch of positions
+         * @param counts an array to receive the move counts
+         */
+        template<Alliance A>
+        void countMoves(const BoardBatch& batch, int* const counts) {
+            static_assert(A == White || A == Black);
+
+            constexpr const Alliance us = A, them = ~us;
+
+            // Determine defaults.
+            constexpr const Defaults* const x = defaults<us>();
+            constexpr const Defaults* const y = defaults<them>();
+
+            // Initialize constant vectors.
+            const Lanes allPieces    = batch.getAllPieces(),
+                        ourPieces    = batch.getPieces<us>(),
+                        theirPieces  = batch.getPieces<them>(),
+                        emptySquares = ~allPieces,
+                        pawns        = batch.getPieces<us, Pawn>(),
+                        king         = batch.getPieces<us, King>(),
+                        theirPawns   = batch.getPieces<them, Pawn>(),
+                        theirQueens  = batch.getPieces<them, Queen>(),
+                        theirRooks   = batch.getPieces<them, Rook>()
+                                       | theirQueens,
+                        theirBishops = batch.getPieces<them, Bishop>()
+                                       | theirQueens,
+                        theirKnights = batch.getPieces<them, Knight>(),
+                        theirKing    = batch.getPieces<them, King>();
+
+            // All squares attacked by enemy pawns, knights and
+            // the enemy king, set-wise.
+            const Lanes leaperDanger =
+                shiftLanes<y->upRight>(theirPawns & y->notRightCol) |
+                shiftLanes<y->upLeft >(theirPawns & y->notLeftCol ) |
+                knightAttacks(theirKnights) | kingAttacks(theirKing);
+
+            // Per-lane check paths and king guards. Lanes in
+            // double check keep an empty check path, which
+            // rules out every non-king move below.
+            Lanes checkPath{}, kingGuard{};
+
+            // Resolve table lookups lane by lane.
+            for (int l = 0; l < batch.size(); ++l) {
+                const uint64_t occ = allPieces[l],
+                               our = ourPieces[l];
+                const int      ksq = bitScanFwd(king[l]);
+
+                // Find all pieces that attack our king.
+                const uint64_t checkBoard =
+                    (attackBoard<Rook>(occ, ksq)   & theirRooks[l])   |
+                    (attackBoard<Bishop>(occ, ksq) & theirBishops[l]) |
+                    (SquareToKnightAttacks[ksq]    & theirKnights[l]) |
+                    (SquareToPawnAttacks[us][ksq]  & theirPawns[l]);
+                const CheckType checkType = calculateCheck(checkBoard);
+
+                // Count king moves, with our king lifted so that it
+                // cannot hide behind itself from a slider, and en
+                // passant moves.
+                int count = safeFromSliders(
+                    SquareToKingAttacks[ksq] & ~our & ~leaperDanger[l],
+                    occ ^ king[l], theirRooks[l], theirBishops[l]
+                ) + countEnPassant<us>(batch, l, ksq);
+
+                if (checkType != DoubleCheck) {
+                    // Find the blockers of sliding attacks on our king.
+                    uint64_t blockers = 0;
+                    const uint64_t snipers =
+                        (attackBoard<Rook>(0, ksq)   & theirRooks[l]) |
+                        (attackBoard<Bishop>(0, ksq) & theirBishops[l]);
+                    for (uint64_t s = snipers; s; s &= s - 1) {
+                        const uint64_t blocker =
+                            pathBoard(bitScanFwd(s), ksq) & occ;
+                        if (blocker && !(blocker & (blocker - 1)))
+                            blockers |= blocker;
+                    }
+                    const uint64_t guard  = our & blockers,
+                                   path   = checkType == Check ?
+                                       pathBoard(ksq, bitScanFwd(checkBoard))
+                                       | checkBoard : FullBoard,
+                                   filter = ~our & path;
+                    checkPath[l] = path;
+                    kingGuard[l] = guard;
+
+                    // Count piece moves.
+                    count +=
+                        countPieceMoves<Rook>  (batch.getPieces<us, Rook>()[l],
+                            occ, guard, filter, ksq) +
+                        countPieceMoves<Knight>(batch.getPieces<us, Knight>()[l],
+                            occ, guard, filter, ksq) +
+                        countPieceMoves<Bishop>(batch.getPieces<us, Bishop>()[l],
+                            occ, guard, filter, ksq) +
+                        countPieceMoves<Queen> (batch.getPieces<us, Queen>()[l],
+                            occ, guard, filter, ksq);
+
+                    // Count pinned pawn moves.
+                    if (pawns[l] & guard)
+                        count += countPinnedPawnMoves<us>(
+                            pawns[l] & guard, ~occ,
+                            theirPieces[l] & path, path, ksq
+                        );
+
+                    // Count castling moves.
+                    const uint8_t rights = batch.getCastlingRights(l);
+                    if (checkType == None) {
+                        if ((rights & Board::castlingBit<us, KingSide>()) &&
+                            !(x->kingSideMask & occ) &&
+                            !(x->kingSideCastlePath & leaperDanger[l]) &&
+                            safeFromSliders(x->kingSideCastlePath, occ,
+                                theirRooks[l], theirBishops[l]) == 2)
+                            ++count;
+                        if ((rights & Board::castlingBit<us, QueenSide>()) &&
+                            !(x->queenSideMask & occ) &&
+                            !(x->queenSideCastlePath & leaperDanger[l]) &&
+                            safeFromSliders(x->queenSideCastlePath, occ,
+                                theirRooks[l], theirBishops[l]) == 2)
+                            ++count;
+                    }
+                }
+                counts[l] = count;
+            }
+
+            // Count free pawn moves set-wise.
+            const Lanes freePawns     = pawns & ~kingGuard,
+                        freeLowPawns  = freePawns & ~x->prePromotionMask,
+                        freeHighPawns = freePawns & x->prePromotionMask,
+                        enemies       = theirPieces & checkPath;
+
+            // Single and double pushes.
+            const Lanes p1 = shiftLanes<x->up>(freeLowPawns) & emptySquares,
+                        p2 = shiftLanes<x->up>(p1 & x->pawnJumpSquares)
+                             & emptySquares & checkPath;
+
+            // Captures.
+            const Lanes ar =
+                shiftLanes<x->upRight>(freeLowPawns & x->notRightCol) & enemies;
+            const Lanes al =
+                shiftLanes<x->upLeft >(freeLowPawns & x->notLeftCol ) & enemies;
+
+            // Promotions.
+            const Lanes q1 = shiftLanes<x->up>(freeHighPawns) & emptySquares
+                             & checkPath,
+                        qr = shiftLanes<x->upRight>(
+                                 freeHighPawns & x->notRightCol) & enemies,
+                        ql = shiftLanes<x->upLeft >(
+                                 freeHighPawns & x->notLeftCol ) & enemies;
+
+            for (int l = 0; l < batch.size(); ++l)
+                counts[l] +=
+                    highBitCount(p1[l] & checkPath[l]) +
+                    highBitCount(p2[l]) +
+                    highBitCount(ar[l]) + highBitCount(al[l]) +
+                    ((highBitCount(q1[l]) + highBitCount(qr[l]) +
+                      highBitCount(ql[l])) << 2U);
+        }
+    } // namespace (anon)
+
+    namespace MoveFactory {
+        void countMoves(const BoardBatch& batch, int* const counts) {
+            return batch.currentPlayer() == White ?
+                   Charon::countMoves<White>(batch, counts) :
+                   Charon::countMoves<Black>(batch, counts);
+        }
+    }
+} // namespace Charon
@@ -0,0 +1,245 @@
+//
+// Created by agent on 10/19/2026.
+//
+
+#pragma once
+#ifndef CHARON_BATCH_H
+#define CHARON_BATCH_H
+
+#include <cstdint>
+#include "ChaosMagic.h"
+#include "Board.h"
+
+namespace Charon {
+
+    /**
+     * The number of positions held by a BoardBatch, one per
+     * 64-bit vector lane: eight with AVX-512 and four with
+     * AVX2.
+     */
+    constexpr int BatchWidth = HasAVX512 ? 8 : 4;
+
+    /**
+     * A vector of bitboards, one per BoardBatch lane. Bitwise
+     * operators and shifts apply lane by lane and compile to
+     * single AVX2 or AVX-512 instructions.
+     */
+    typedef uint64_t Lanes
+        __attribute__((vector_size(BatchWidth * sizeof(uint64_t))));
+
+    /**
+     * <summary>
+     *  <p>
+     * A BoardBatch is a structure-of-arrays container for up to
+     * BatchWidth positions with the same player to move. Each
+     * piece bitboard is stored as one vector, with one lane per
+     * position, so that set-wise move generation can advance
+     * every position in the batch at once.
+     *  </p>
+     *  <p>
+     * A batch is filled by copying Boards into it, which makes
+     * it a natural fit for the leaves of a perft tree: the
+     * children of a depth-2 node are gathered into a batch and
+     * all of their legal moves are counted in one pass.
+     *  </p>
+     * </summary>
+     *
+     * @class BoardBatch
+     * @author agent
+     * @version 10.19.2026
+     */
+    class BoardBatch final {
+    private:
+
+        /**
+         * @private
+         * Piece bitboard lanes for the various piece types.
+         */
+        Lanes pieces[2][7]{};
+
+        /**
+         * @private
+         * All piece bitboards sandwiched together, per lane.
+         */
+        Lanes allPieces{};
+
+        /**
+         * @private
+         * The castling rights of each lane.
+         */
+        uint8_t castlingRights[BatchWidth]{};
+
+        /**
+         * @private
+         * The en passant square of each lane.
+         */
+        Square epSquare[BatchWidth]{};
+
+        /**
+         * @private
+         * The alliance of the player to move in every lane.
+         */
+        Alliance currentPlayerAlliance;
+
+        /**
+         * @private
+         * The number of lanes in use.
+         */
+        int count;
+    public:
+
+        /**
+         * @public
+         * A public constructor for an empty BoardBatch.
+         *
+         * @param a the alliance of the player to move in
+         * every position that will be added
+         */
+        explicit constexpr BoardBatch(const Alliance a) :
+        currentPlayerAlliance(a), count(0)
+        {  }
+
+        /** @public Deleted copy constructor. */
+        BoardBatch(const BoardBatch&) = delete;
+
+        /** @public Deleted move constructor. */
+        BoardBatch(BoardBatch&&) = delete;
+
+        /**
+         * A method to copy the given board into the next free
+         * lane of this batch. The board's current player must
+         * match the batch.
+         *
+         * @param board the board to copy
+         */
+        inline void push(const Board& board) {
+            assert(count < BatchWidth);
+            assert(board.currentPlayerAlliance == currentPlayerAlliance);
+            for (int a = White; a <= Black; ++a)
+                for (int pt = Pawn; pt <= NullPT; ++pt)
+                    pieces[a][pt][count] = board.pieces[a][pt];
+            allPieces[count]      = board.allPieces;
+            castlingRights[count] = board.currentState->castlingRights;
+            epSquare[count]       = board.currentState->epSquare;
+            ++count;
+        }
+
+        /**
+         * A method to empty this batch. Stale lanes are left in
+         * place: set-wise work still runs over them, but their
+         * results are never read.
+         */
+        constexpr void clear()
+        { count = 0; }
+
+        /**
+         * A method to expose the number of lanes in use.
+         *
+         * @return the number of positions in this batch
+         */
+        [[nodiscard]]
+        constexpr int size() const
+        { return count; }
+
+        /**
+         * A method to determine whether this batch is full.
+         *
+         * @return whether or not every lane is in use
+         */
+        [[nodiscard]]
+        constexpr bool full() const
+        { return count == BatchWidth; }
+
+        /**
+         * A method to expose the current player's alliance.
+         *
+         * @return the current player's alliance
+         */
+        [[nodiscard]]
+        constexpr Alliance currentPlayer() const
+        { return currentPlayerAlliance; }
+
+        /**
+         * A method to expose each piece bitboard vector.
+         *
+         * @tparam A the alliance of the bitboards
+         * @tparam PT the piece type of the bitboards
+         * @return a vector of piece bitboards
+         */
+        template<Alliance A, PieceType PT>
+        [[nodiscard]]
+        constexpr Lanes getPieces() const
+        { return pieces[A][PT]; }
+
+        /**
+         * A method to expose a vector of half-sandwich
+         * bitboards of all pieces belonging to the given
+         * alliance.
+         *
+         * @tparam A the alliance of the bitboards
+         * @return a vector of bitboards of all pieces
+         * belonging to the given alliance
+         */
+        template<Alliance A>
+        [[nodiscard]]
+        constexpr Lanes getPieces() const
+        { return pieces[A][NullPT]; }
+
+        /**
+         * A method to expose the vector of all piece
+         * bitboards.
+         *
+         * @return a vector of occupancy bitboards
+         */
+        [[nodiscard]]
+        constexpr Lanes getAllPieces() const
+        { return allPieces; }
+
+        /**
+         * A method to expose the castling rights of a lane.
+         *
+         * @param lane the lane
+         * @return the castling rights of the given lane
+         */
+        [[nodiscard]]
+        constexpr uint8_t getCastlingRights(const int lane) const
+        { return castlingRights[lane]; }
+
+        /**
+         * A method to expose the en passant square of a lane.
+         *
+         * @param lane the lane
+         * @return the en passant square of the given lane
+         */
+        [[nodiscard]]
+        constexpr int getEpSquare(const int lane) const
+        { return epSquare[lane]; }
+    };
+
+    namespace MoveFactory {
+
+        /**
+         * <summary>
+         *  <p><br/>
+         * A function to count the legal moves of every
+         * position in the given batch, without generating
+         * them.
+         *  </p>
+         *  <p>
+         * Occupancy, filters, enemy pawn, knight and king
+         * attacks and free pawn moves are computed set-wise
+         * across all lanes at once. Slider lookups, pins and
+         * en passant are resolved lane by lane.
+         *  </p>
+         * </summary>
+         *
+         * @param batch  the batch of positions
+         * @param counts an array of at least batch.size()
+         *               integers to receive the move count
+         *               of each lane
+         */
+        void countMoves(const BoardBatch& batch, int* counts);
+    }
+}
+
+#endif //CHARON_BATCH_H
@@ -8,9 +8,12 @@
 #include <iostream>
 #include <ostream>
 #include <cstdint>
+#include <algorithm>
 #include <locale>
 #include "ChaosMagic.h"
 #include "Move.h"
+#include "Zobrist.h"
+#include "Eval.h"
 
 namespace Charon {
 
@@ -122,15 +125,83 @@ namespace Charon {
     constexpr const Defaults* defaults()
     { return A == White? &WhiteDefaults : &BlackDefaults; }
 
+    /**
+     * The capacity of the State stack owned by each Board:
+     * the longest line of play, game plus search, that a
+     * Board can hold.
+     */
+    constexpr int MaxPly = 1024;
+
+    /**
+     * Piece values for static exchange evaluation, indexed
+     * by PieceType. The king is worth more than everything
+     * else combined, so that no exchange ever gives it up.
+     */
+    constexpr int SeeValues[] = { 100, 500, 325, 325, 1000, 20000, 0 };
+
+    /**
+     * <summary>
+     * A struct to hold the check information of one node,
+     * from the point of view of the player to move: where
+     * each piece type would have to land to check the enemy
+     * king, and which of our pieces would uncover a check by
+     * moving off of a line.
+     * </summary>
+     *
+     * @struct CheckInfo
+     */
+    struct CheckInfo final {
+        uint64_t checkSquares[6];
+        uint64_t discoverers;
+        int      kingSquare;
+    };
+
+    /**
+     * <summary>
+     * A struct to hold the pieces a move picked up and put
+     * down, so that incremental evaluators can replay the
+     * move without decoding it again. A capture-promotion
+     * changes the most pieces: three.
+     * </summary>
+     *
+     * @struct Delta
+     */
+    struct Delta final {
+        uint8_t count;
+        uint8_t piece[3];
+        Square  from[3];
+        Square  to[3];
+
+        /**
+         * A method to record one piece change.
+         *
+         * @param a    the alliance of the piece
+         * @param pt   the type of the piece
+         * @param from the square it left, or NullSQ if it
+         *             was put down
+         * @param to   the square it reached, or NullSQ if it
+         *             was picked up
+         */
+        constexpr void add(const int a, const int pt,
+                           const int from, const int to) {
+            piece[count]      = a * 6 + pt;
+            this->from[count] = Square(from);
+            this->to[count]   = Square(to);
+            ++count;
+        }
+    };
+
     /**
      * <summary>
      * A struct to keep track of the board state, for use in
-     * applying and retracting count.
+     * applying and retracting count. States live on a
+     * contiguous stack owned by the Board, one per ply, so
+     * the previous State is always the one just below.
      * </summary>
      *
      * @struct State
      */
-    class State final {
+    class alignas(4) State final {
     private:
         /**
          * @private
@@ -138,6 +209,12 @@ namespace Charon {
          */
         friend class Board;
 
+        /**
+         * @private
+         * BoardBatch copies States lane by lane.
+         */
+        friend class BoardBatch;
+
         /**
          * @private
          * The castling rights for this State.
@@ -152,25 +229,88 @@ namespace Charon {
 
         /**
          * @private
-         * The previous State.
+         * The captured piece for this State.
+         */
+        PieceType capturedPiece;
+
+        /**
+         * @private
+         * The number of plies since the last capture or
+         * pawn move.
          */
-        State* prevState;
+        uint16_t halfmoveClock;
 
         /**
          * @private
-         * The captured piece for this State.
+         * The number of plies since the last null move, or
+         * since the bottom of the stack if there was none.
          */
-        PieceType capturedPiece;
+        uint16_t pliesFromNull;
+
+        /**
+         * @private
+         * The pieces moved by the move that led to this
+         * State.
+         */
+        Delta delta;
+
+        /**
+         * @private
+         * The Zobrist key of the position in this State.
+         */
+        uint64_t key;
+
+        /**
+         * @private
+         * The Zobrist key of the pawns alone in this State.
+         */
+        uint64_t pawnKey;
+
+        /**
+         * @private
+         * The packed material and piece-square score of
+         * the position in this State, from White's point
+         * of view.
+         */
+        Evaluation::Score psq;
+
+        /**
+         * @private
+         * The game phase of the position in this State.
+         */
+        int phase;
     public:
 
         /**
-         * A default constructor for this State.
+         * A default constructor that leaves this State
+         * unwritten. Every field of a State is written when a
+         * move is applied onto it, so the stack above the
+         * bottom State needs no initialization, and a Board is
+         * cheap to build.
+         */
+        State() = default;
+
+        /**
+         * A constructor for the State at the bottom of the
+         * stack. The keys and the score are summed in by Board.
+         *
+         * @param castlingRights the castling rights
+         * @param epSquare       the en passant square
+         * @param halfmoveClock  the halfmove clock
          */
-        constexpr State() :
-        castlingRights(0x0FU),
-        epSquare(NullSQ),
-        prevState(nullptr),
-        capturedPiece(NullPT)
+        constexpr State(const uint8_t castlingRights,
+                        const Square epSquare,
+                        const uint16_t halfmoveClock) :
+        castlingRights(castlingRights),
+        epSquare(epSquare),
+        capturedPiece(NullPT),
+        halfmoveClock(halfmoveClock),
+        pliesFromNull(halfmoveClock),
+        delta{},
+        key(0),
+        pawnKey(0),
+        psq(0),
+        phase(0)
         {  }
     };
 
@@ -194,6 +334,12 @@ namespace Charon {
     class Board final {
     private:
 
+        /**
+         * @private
+         * BoardBatch copies boards lane by lane.
+         */
+        friend class BoardBatch;
+
         // masks for castling rights.
         static constexpr uint16_t Wkoff = 0x0DU;
         static constexpr uint16_t Bkoff = 0x07U;
@@ -241,10 +387,155 @@ namespace Charon {
 
         /**
          * @private
-         * A pointer to an externally-allocated state
-         * object to optimize move retraction.
+         * The State stack, one State per ply played on
+         * this board.
+         */
+        State history[MaxPly];
+
+        /**
+         * @private
+         * A pointer to the top of the State stack.
          */
         State* currentState;
+
+        /**
+         * @private
+         * The number of plies played in the game before
+         * the bottom of the State stack.
+         */
+        int gamePly;
+
+        /**
+         * @private
+         * A method to find the pieces of both alliances that
+         * attack the given square, given an occupancy.
+         *
+         * @param sq  the square under attack
+         * @param occ the occupancy to see through
+         * @return a bitboard of all attackers of the square
+         */
+        [[nodiscard]]
+        inline uint64_t attackersTo(const int sq, const uint64_t occ) const {
+            return (SquareToPawnAttacks[White][sq] & pieces[Black][Pawn])     |
+                   (SquareToPawnAttacks[Black][sq] & pieces[White][Pawn])     |
+                   (SquareToKnightAttacks[sq]      &
+                   (pieces[White][Knight] | pieces[Black][Knight]))           |
+                   (SquareToKingAttacks[sq]        &
+                   (pieces[White][King]   | pieces[Black][King]))             |
+                   (attackBoard<Rook>(occ, sq)     & orthogonalSliders())    |
+                   (attackBoard<Bishop>(occ, sq)   & diagonalSliders())      ;
+        }
+
+        /**
+         * @private
+         * @return a bitboard of all rooks and queens
+         */
+        [[nodiscard]]
+        constexpr uint64_t orthogonalSliders() const {
+            return pieces[White][Rook]  | pieces[Black][Rook] |
+                   pieces[White][Queen] | pieces[Black][Queen];
+        }
+
+        /**
+         * @private
+         * @return a bitboard of all bishops and queens
+         */
+        [[nodiscard]]
+        constexpr uint64_t diagonalSliders() const {
+            return pieces[White][Bishop] | pieces[Black][Bishop] |
+                   pieces[White][Queen]  | pieces[Black][Queen];
+        }
+
+        /**
+         * @private
+         * A method to lift the least valuable of the given
+         * attackers off of the occupancy, revealing any
+         * slider behind it.
+         *
+         * @param sq        the square under attack
+         * @param mine      the attackers to choose from
+         * @param occ       the occupancy, updated in place
+         * @param attackers all attackers, updated in place with
+         *                  any x-ray attackers revealed
+         * @return the type of the lifted piece
+         */
+        inline PieceType
+        liftLeastValuable(const int sq, const uint64_t mine,
+                          uint64_t& occ, uint64_t& attackers) const {
+            constexpr PieceType Order[] =
+                { Pawn, Knight, Bishop, Rook, Queen, King };
+            for(const PieceType pt : Order) {
+                const uint64_t b = mine &
+                    (pieces[White][pt] | pieces[Black][pt]);
+                if(!b) continue;
+                occ ^= b & -b;
+                if(pt == Pawn || pt == Bishop || pt == Queen)
+                    attackers |= attackBoard<Bishop>(occ, sq) &
+                                 diagonalSliders();
+                if(pt == Rook || pt == Queen)
+                    attackers |= attackBoard<Rook>(occ, sq) &
+                                 orthogonalSliders();
+                attackers &= occ;
+                return pt;
+            }
+            return NullPT;
+        }
+
+        /**
+         * @private
+         * A method to find the en passant key of the current
+         * position. As in Polyglot::key, the square counts
+         * only if a pawn of the player to move stands beside
+         * the pawn that was pushed, so that a double push no
+         * pawn can take hashes like a single push.
+         *
+         * @return the key of the en passant square, or zero
+         */
+        [[nodiscard]]
+        constexpr uint64_t epKey() const {
+            const int ep = currentState->epSquare;
+            if(ep == NullSQ) return 0;
+            const uint64_t pushed = SquareToBitBoard[ep];
+            return ((pushed << 1U & ~Files[0]) |
+                    (pushed >> 1U & ~Files[7])) &
+                   pieces[currentPlayerAlliance][Pawn] ?
+                Zobrist::enPassant(ep) : 0;
+        }
+
+        /**
+         * @private
+         * A method to compute the Zobrist key of the
+         * current position from scratch.
+         *
+         * @return the Zobrist key of the current position
+         */
+        [[nodiscard]]
+        constexpr uint64_t computeKey() const {
+            uint64_t k = Zobrist::castling(currentState->castlingRights) ^
+                         epKey();
+            if(currentPlayerAlliance == Black) k ^= Zobrist::Side;
+            for(int a = White; a <= Black; ++a)
+                for(int pt = Pawn; pt < NullPT; ++pt)
+                    for(uint64_t x = pieces[a][pt]; x; x &= x - 1)
+                        k ^= Zobrist::piece(a, pt, bitScanFwd(x));
+            return k;
+        }
+
+        /**
+         * @private
+         * A method to compute the pawn key of the current
+         * position from scratch.
+         *
+         * @return the Zobrist key of the pawns alone
+         */
+        [[nodiscard]]
+        constexpr uint64_t computePawnKey() const {
+            uint64_t k = 0;
+            for(int a = White; a <= Black; ++a)
+                for(uint64_t x = pieces[a][Pawn]; x; x &= x - 1)
+                    k ^= Zobrist::piece(a, Pawn, bitScanFwd(x));
+            return k;
+        }
     public:
 
         /**
@@ -264,7 +555,7 @@ namespace Charon {
          * @return a piece bitboard
          */
         template<Alliance A, PieceType PT>
-        constexpr uint64_t getPieces()
+        constexpr uint64_t getPieces() const
         { return pieces[A][PT]; }
 
         /**
@@ -277,7 +568,7 @@ namespace Charon {
          * to the given alliance
          */
         template<Alliance A>
-        constexpr uint64_t getPieces()
+        constexpr uint64_t getPieces() const
         { return pieces[A][NullPT]; }
 
         /**
@@ -291,16 +582,43 @@ namespace Charon {
          */
         template <Alliance A, CastleType CT>
         [[nodiscard]]
-        constexpr bool hasCastlingRights() const {
+        constexpr bool hasCastlingRights() const
+        { return currentState->castlingRights & castlingBit<A, CT>(); }
+
+        /**
+         * A function to expose the bit that a State sets in
+         * its castling rights for the given castle, so that
+         * code which copies the rights out of a State reads
+         * them the way Board does.
+         *
+         * @tparam A the alliance
+         * @tparam CT the castle type
+         * @return the bit of the castling rights
+         */
+        template <Alliance A, CastleType CT>
+        [[nodiscard]]
+        static constexpr uint16_t castlingBit() {
             static_assert(A == White || A == Black);
             static_assert(CT == KingSide || CT == QueenSide);
             return A == White ?
-                   CT == KingSide ?
-                   (currentState->castlingRights & 0x02U) >> 1U:
-                   currentState->castlingRights & 0x01U :
-                   CT == KingSide ?
-                   (currentState->castlingRights & 0x08U) >> 3U :
-                   (currentState->castlingRights & 0x04U) >> 2U ;
+                   CT == KingSide ? Wkon : Wqon :
+                   CT == KingSide ? Bkon : Bqon ;
+        }
+
+        /**
+         * A method to determine whether the current State
+         * holds any castling rights for the given alliance.
+         *
+         * @tparam A the alliance
+         * @return whether or not the given alliance may
+         * castle to either side
+         */
+        template <Alliance A>
+        [[nodiscard]]
+        constexpr bool hasCastlingRights() const {
+            static_assert(A == White || A == Black);
+            return currentState->castlingRights &
+                   (A == White ? Wkon | Wqon : Bkon | Bqon);
         }
 
         /**
@@ -380,12 +698,50 @@ namespace Charon {
             return out << in.toString();
         }
 
-        /** @public Deleted copy constructor. */
-        Board(const Board&) = delete;
+        /**
+         * @public
+         * A copy constructor to clone a board, along with
+         * the live part of its State stack.
+         *
+         * @param other the board to clone
+         */
+        Board(const Board& other) :
+        allPieces(other.allPieces),
+        currentPlayerAlliance(other.currentPlayerAlliance),
+        currentState(history + (other.currentState - other.history)),
+        gamePly(other.gamePly) {
+            std::copy(&other.pieces[0][0], &other.pieces[0][0] + 14,
+                      &pieces[0][0]);
+            std::copy(other.mailbox, other.mailbox + BoardLength, mailbox);
+            std::copy(other.history,
+                      other.history + (currentState - history) + 1,
+                      history);
+        }
 
         /** @public Deleted move constructor. */
         Board(Board&&) = delete;
 
+        /**
+         * @public
+         * A method to drop the States below the last capture
+         * or pawn move, which no repetition can reach back
+         * to, and to slide the rest to the bottom of the
+         * stack. The dropped moves can no longer be
+         * retracted. A client that plays a whole game into a
+         * board calls this after each move, so that the game
+         * leaves the stack free for the search.
+         */
+        inline void rebase() {
+            const int depth = int(currentState - history),
+                      keep  = std::min(
+                          (int) currentState->halfmoveClock, depth
+                      );
+            if (keep == depth) return;
+            std::copy(currentState - keep, currentState + 1, history);
+            gamePly     += depth - keep;
+            currentState = history + keep;
+        }
+
         /**
          * <summary>
          *  <p><br/>
@@ -436,28 +792,48 @@ namespace Charon {
 
             /**
              * @private
-             * The initial state of the board under
+             * The initial castling rights of the board under
+             * construction.
+             */
+            uint8_t castlingRights;
+
+            /**
+             * @private
+             * The initial en passant square of the board under
+             * construction.
+             */
+            Square epSquare;
+
+            /**
+             * @private
+             * The initial halfmove clock of the board under
+             * construction.
+             */
+            int halfmoveClock;
+
+            /**
+             * @private
+             * The initial fullmove number of the board under
              * construction.
              */
-            State* state;
+            int fullmoveNumber;
         public:
 
             /**
              * @public
              * A public constructor for a Builder.
-             *
-             * @param s the initial state of the board
-             * under construction.
              */
-            explicit constexpr Builder(State& s) :
+            explicit constexpr Builder() :
             currentPlayerAlliance(White),
-            state(&s) {
+            castlingRights(BT == Fen ? 0 : 0x0FU),
+            epSquare(NullSQ),
+            halfmoveClock(0),
+            fullmoveNumber(1) {
                 if(BT == Fen) {
                     for (auto& alliance : pieces) {
                         for (uint64_t& p : alliance)
                             p = 0;
                     }
-                    s.castlingRights = 0;
                 }
             }
 
@@ -470,7 +846,10 @@ namespace Charon {
              */
             explicit constexpr Builder(const Board& board) :
             currentPlayerAlliance(~board.currentPlayerAlliance),
-            state(board.currentState) {
+            castlingRights(board.currentState->castlingRights),
+            epSquare(board.currentState->epSquare),
+            halfmoveClock(board.currentState->halfmoveClock),
+            fullmoveNumber(board.getFullmoveNumber()) {
                 pieces[White][Pawn]    = board.pieces[White][Pawn];
                 pieces[White][Rook]    = board.pieces[White][Rook] ;
                 pieces[White][Knight]  = board.pieces[White][Knight];
@@ -533,7 +912,28 @@ namespace Charon {
              * @return a reference to the instance
              */
             constexpr Builder& setEnPassantSquare(const Square square)
-            { state->epSquare = square; return *this; }
+            { epSquare = square; return *this; }
+
+            /**
+             * A method to set the halfmove clock of the board
+             * under construction.
+             *
+             * @param clock the number of plies since the last
+             * capture or pawn move
+             * @return a reference to the instance
+             */
+            constexpr Builder& setHalfmoveClock(const int clock)
+            { halfmoveClock = clock; return *this; }
+
+            /**
+             * A method to set the fullmove number of the board
+             * under construction.
+             *
+             * @param number the fullmove number, starting at 1
+             * @return a reference to the instance
+             */
+            constexpr Builder& setFullmoveNumber(const int number)
+            { fullmoveNumber = number; return *this; }
 
             /**
              * A method to set the castling rights of the initial
@@ -551,13 +951,13 @@ namespace Charon {
                 static_assert(A == White || A == Black);
                 static_assert(CT == KingSide || CT == QueenSide);
                 if(!B)
-                    state->castlingRights &= A == White?
+                    castlingRights &= A == White?
                         CT == KingSide ?
                             Wkoff : Wqoff :
                         CT == KingSide ?
                             Bkoff : Bqoff;
                 else
-                    state->castlingRights |= A == White?
+                    castlingRights |= A == White?
                         CT == KingSide ?
                             Wkon : Wqon :
                         CT == KingSide ?
@@ -578,26 +978,26 @@ namespace Charon {
             constexpr Builder& setCastlingRights(const char c) {
                 if(!B) {
                     switch (c) {
-                        case 'K': state->castlingRights &= Wkoff;
+                        case 'K': castlingRights &= Wkoff;
                             break;
-                        case 'Q': state->castlingRights &= Wqoff;
+                        case 'Q': castlingRights &= Wqoff;
                             break;
-                        case 'k': state->castlingRights &= Bkoff;
+                        case 'k': castlingRights &= Bkoff;
                             break;
-                        case 'q': state->castlingRights &= Bqoff;
+                        case 'q': castlingRights &= Bqoff;
                             break;
                         default: assert(false);
                     }
                 }
                 else   {
                     switch (c) {
-                        case 'K': state->castlingRights |= Wkon;
+                        case 'K': castlingRights |= Wkon;
                             break;
-                        case 'Q': state->castlingRights |= Wqon;
+                        case 'Q': castlingRights |= Wqon;
                             break;
-                        case 'k': state->castlingRights |= Bkon;
+                        case 'k': castlingRights |= Bkon;
                             break;
-                        case 'q': state->castlingRights |= Bqon;
+                        case 'q': castlingRights |= Bqon;
                             break;
                         default: assert(false);
                     }
@@ -691,7 +1091,11 @@ namespace Charon {
         explicit constexpr Board(const Builder<BT>& b) :
         allPieces(0),
         currentPlayerAlliance(b.currentPlayerAlliance),
-        currentState(b.state) {
+        currentState(history),
+        gamePly(2 * (b.fullmoveNumber - 1) +
+                (b.currentPlayerAlliance == Black)) {
+            *currentState = State(b.castlingRights, b.epSquare,
+                                  (uint16_t) b.halfmoveClock);
             initPieceBoards<White>(pieces[White], b);
             initPieceBoards<Black>(pieces[Black], b);
             for (int j = Pawn; j < NullPT; ++j) {
@@ -702,21 +1106,43 @@ namespace Charon {
             }
             allPieces =
                 pieces[White][NullPT] | pieces[Black][NullPT];
+            currentState->key     = computeKey();
+            currentState->pawnKey = computePawnKey();
+            for(int a = White; a <= Black; ++a)
+                for(int pt = Pawn; pt < NullPT; ++pt)
+                    for(uint64_t x = pieces[a][pt]; x; x &= x - 1) {
+                        currentState->psq +=
+                            Evaluation::psq(a, pt, bitScanFwd(x));
+                        currentState->phase +=
+                            Evaluation::PhaseWeights[pt];
+                    }
         }
 
         template<Alliance A>
-        constexpr void applyMove(const Move& m, State& state) {
+        constexpr void applyMove(const Move& m) {
             static_assert(A == White || A == Black);
             // ASSUME THAT THE MOVE IS LEGAL ! ! !
-            assert(currentState != &state);
+            assert(currentState < history + MaxPly - 1);
+            State& state = currentState[1];
             const int  origin      = m.origin(),
                        destination = m.destination();
             const bool isPromotion = m.isPromotion();
             const PieceType captureType = mailbox[destination],
                             activeType  = mailbox[origin];
+            uint64_t key = currentState->key ^ Zobrist::Side ^
+                Zobrist::castling(currentState->castlingRights) ^
+                epKey();
             state.capturedPiece  = captureType;
             state.castlingRights = currentState->castlingRights;
-            state.prevState      = currentState;
+            state.epSquare       = NullSQ;
+            state.halfmoveClock  =
+                activeType == Pawn || captureType != NullPT ?
+                0 : currentState->halfmoveClock + 1;
+            state.pliesFromNull  = currentState->pliesFromNull + 1;
+            state.pawnKey        = currentState->pawnKey;
+            state.psq            = currentState->psq;
+            state.phase          = currentState->phase;
+            state.delta.count    = 0;
             currentState         = &state;
             constexpr const Alliance us = A, them = ~us;
             const uint64_t originBoard      = SquareToBitBoard[origin],
@@ -726,6 +1152,14 @@ namespace Charon {
             mailbox[origin] = NullPT;
             mailbox[destination] = activeType;
             currentPlayerAlliance = them;
+            if(captureType != NullPT) {
+                key         ^= Zobrist::piece(them, captureType, destination);
+                state.psq   -= Evaluation::psq(them, captureType, destination);
+                state.phase -= Evaluation::PhaseWeights[captureType];
+                state.delta.add(them, captureType, destination, NullSQ);
+                if(captureType == Pawn)
+                    state.pawnKey ^= Zobrist::piece(them, Pawn, destination);
+            }
             if(captureType == Rook) {
                 constexpr const Defaults* xx = defaults<them>();
                 if(destination == xx->kingSideRookOrigin)
@@ -743,6 +1177,16 @@ namespace Charon {
                 }
                 allPieces = pieces[us][NullPT] | pieces[them][NullPT];
                 mailbox[destination] = PieceType(m.promotionPiece());
+                currentState->key = key ^
+                    Zobrist::piece(us, Pawn, origin) ^
+                    Zobrist::piece(us, m.promotionPiece(), destination) ^
+                    Zobrist::castling(currentState->castlingRights);
+                state.psq   += Evaluation::psq(us, m.promotionPiece(), destination) -
+                               Evaluation::psq(us, Pawn, origin);
+                state.phase += Evaluation::PhaseWeights[m.promotionPiece()];
+                state.pawnKey ^= Zobrist::piece(us, Pawn, origin);
+                state.delta.add(us, Pawn, origin, NullSQ);
+                state.delta.add(us, m.promotionPiece(), NullSQ, destination);
                 return;
             }
             const int moveType = m.moveType();
@@ -764,6 +1208,15 @@ namespace Charon {
                 allPieces = pieces[us][NullPT] | pieces[them][NullPT];
                 currentState->epSquare = moveType == PawnJump ?
                         Square(destination) : NullSQ;
+                key ^= Zobrist::piece(us, activeType, origin)      ^
+                       Zobrist::piece(us, activeType, destination) ^
+                       epKey();
+                state.psq += Evaluation::psq(us, activeType, destination) -
+                             Evaluation::psq(us, activeType, origin);
+                state.delta.add(us, activeType, origin, destination);
+                if(activeType == Pawn)
+                    state.pawnKey ^= Zobrist::piece(us, Pawn, origin) ^
+                                     Zobrist::piece(us, Pawn, destination);
             }
             else if(moveType == Castling) {
                 currentState->castlingRights &= us == White? 0x0CU: 0x03U;
@@ -772,19 +1225,38 @@ namespace Charon {
                     rookMoveBB = x->kingSideRookMoveMask;
                     mailbox[x->kingSideRookOrigin] = NullPT;
                     mailbox[x->kingSideRookDestination] = Rook;
+                    key ^= Zobrist::piece(us, Rook, x->kingSideRookOrigin) ^
+                           Zobrist::piece(us, Rook, x->kingSideRookDestination);
+                    state.psq +=
+                        Evaluation::psq(us, Rook, x->kingSideRookDestination) -
+                        Evaluation::psq(us, Rook, x->kingSideRookOrigin);
+                    state.delta.add(us, Rook, x->kingSideRookOrigin,
+                                    x->kingSideRookDestination);
                 } else {
                     rookMoveBB = x->queenSideRookMoveMask;
                     mailbox[x->queenSideRookOrigin] = NullPT;
                     mailbox[x->queenSideRookDestination] = Rook;
+                    key ^= Zobrist::piece(us, Rook, x->queenSideRookOrigin) ^
+                           Zobrist::piece(us, Rook, x->queenSideRookDestination);
+                    state.psq +=
+                        Evaluation::psq(us, Rook, x->queenSideRookDestination) -
+                        Evaluation::psq(us, Rook, x->queenSideRookOrigin);
+                    state.delta.add(us, Rook, x->queenSideRookOrigin,
+                                    x->queenSideRookDestination);
                 }
                 const uint64_t fullBB = moveBB | rookMoveBB;
                 pieces[us][Rook]   ^= rookMoveBB;
                 pieces[us][King]   ^= moveBB;
                 pieces[us][NullPT] ^= fullBB;
                 allPieces          ^= fullBB;
+                key ^= Zobrist::piece(us, King, origin) ^
+                       Zobrist::piece(us, King, destination);
+                state.psq += Evaluation::psq(us, King, destination) -
+                             Evaluation::psq(us, King, origin);
+                state.delta.add(us, King, origin, destination);
             }
             else if(moveType == EnPassant) {
-                const int epSquare = currentState->prevState->epSquare;
+                const int epSquare = currentState[-1].epSquare;
                 const uint64_t captureBB = SquareToBitBoard[epSquare];
                 pieces[us][Pawn]     ^= moveBB;
                 pieces[us][NullPT]   ^= moveBB;
@@ -792,7 +1264,20 @@ namespace Charon {
                 pieces[them][NullPT] ^= captureBB;
                 allPieces = pieces[us][NullPT] | pieces[them][NullPT];
                 mailbox[epSquare] = NullPT;
+                key ^= Zobrist::piece(us, Pawn, origin)      ^
+                       Zobrist::piece(us, Pawn, destination) ^
+                       Zobrist::piece(them, Pawn, epSquare);
+                state.psq += Evaluation::psq(us, Pawn, destination) -
+                             Evaluation::psq(us, Pawn, origin)      -
+                             Evaluation::psq(them, Pawn, epSquare);
+                state.pawnKey ^= Zobrist::piece(us, Pawn, origin)      ^
+                                 Zobrist::piece(us, Pawn, destination) ^
+                                 Zobrist::piece(them, Pawn, epSquare);
+                state.delta.add(us, Pawn, origin, destination);
+                state.delta.add(them, Pawn, epSquare, NullSQ);
             }
+            currentState->key =
+                key ^ Zobrist::castling(currentState->castlingRights);
         }
 
         template<Alliance A>
@@ -821,7 +1306,7 @@ namespace Charon {
                     pieces[them][captureType] |= destinationBoard;
                 }
                 allPieces = pieces[us][NullPT] | pieces[them][NullPT];
-                currentState = currentState->prevState;
+                --currentState;
                 return;
             }
             mailbox[origin] = activeType;
@@ -854,7 +1339,7 @@ namespace Charon {
                 allPieces          ^= fullBB;
             }
             else {
-                const uint64_t epSquare  = currentState->prevState->epSquare;
+                const uint64_t epSquare  = currentState[-1].epSquare;
                 const uint64_t captureBB = SquareToBitBoard[epSquare];
                 pieces[us][Pawn]     ^= moveBB;
                 pieces[us][NullPT]   ^= moveBB;
@@ -863,7 +1348,7 @@ namespace Charon {
                 allPieces = pieces[us][NullPT] | pieces[them][NullPT];
                 mailbox[epSquare] = Pawn;
             }
-            currentState = currentState->prevState;
+            --currentState;
         }
 
     public:
@@ -876,14 +1361,434 @@ namespace Charon {
         constexpr int getEpSquare() const
         { return currentState->epSquare; }
 
+        /**
+         * A method to expose the pieces moved by a recent
+         * move.
+         *
+         * @param pliesAgo how many moves back to look: zero
+         *                 for the move just played
+         * @return the pieces the move picked up and put down
+         */
+        [[nodiscard]]
+        constexpr const Delta& getDelta(const int pliesAgo) const
+        { return currentState[-pliesAgo].delta; }
+
+        /**
+         * A method to expose the Zobrist key of the current
+         * position.
+         *
+         * @return the Zobrist key of the current position
+         */
+        [[nodiscard]]
+        constexpr uint64_t getKey() const
+        { return currentState->key; }
+
+        /**
+         * A method to expose the Zobrist key of the pawns of
+         * the current position, for the pawn hash table.
+         *
+         * @return the Zobrist key of the pawns alone
+         */
+        [[nodiscard]]
+        constexpr uint64_t getPawnKey() const
+        { return currentState->pawnKey; }
+
+        /**
+         * A method to expose the halfmove clock.
+         *
+         * @return the number of plies since the last capture
+         * or pawn move
+         */
+        [[nodiscard]]
+        constexpr int getHalfmoveClock() const
+        { return currentState->halfmoveClock; }
+
+        /**
+         * A method to expose the fullmove number.
+         *
+         * @return the fullmove number, starting at 1
+         */
+        [[nodiscard]]
+        constexpr int getFullmoveNumber() const
+        { return (gamePly + int(currentState - history)) / 2 + 1; }
+
+        /**
+         * <summary>
+         *  <p><br/>
+         * A method to determine whether the current position
+         * has occurred before.
+         *  </p>
+         *  <p>
+         * Only States of the same player to move, back to the
+         * last capture, pawn move or null move, can hold the
+         * same position, so the scan reads every other key of that
+         * stretch of the stack and usually stops after a few
+         * plies.
+         *  </p>
+         * </summary>
+         *
+         * @return whether or not the current position repeats
+         * an earlier one
+         */
+        [[nodiscard]]
+        constexpr bool isRepetition() const {
+            const int back = std::min({
+                (int) currentState->halfmoveClock,
+                (int) currentState->pliesFromNull,
+                int(currentState - history)
+            });
+            for(int i = 4; i <= back; i += 2)
+                if(currentState[-i].key == currentState->key)
+                    return true;
+            return false;
+        }
+
+        /**
+         * A method to determine whether the fifty-move rule
+         * applies. The caller must rule out checkmate, which
+         * takes precedence.
+         *
+         * @return whether or not fifty moves have passed
+         * without a capture or a pawn move
+         */
+        [[nodiscard]]
+        constexpr bool isFiftyMoveDraw() const
+        { return currentState->halfmoveClock >= 100; }
+
+        /**
+         * A method to determine whether the current position
+         * is drawn by repetition or by the fifty-move rule.
+         *
+         * @return whether or not the current position is a
+         * draw
+         */
+        [[nodiscard]]
+        constexpr bool isDraw() const
+        { return isFiftyMoveDraw() || isRepetition(); }
+
+        /**
+         * A method to expose the packed material and
+         * piece-square score of the current position.
+         *
+         * @return the packed score, from White's point of
+         * view
+         */
+        [[nodiscard]]
+        constexpr Evaluation::Score getPsq() const
+        { return currentState->psq; }
+
+        /**
+         * A method to expose the game phase of the current
+         * position.
+         *
+         * @return the game phase, from 0 (bare kings) to
+         * Evaluation::MaxPhase or more
+         */
+        [[nodiscard]]
+        constexpr int getPhase() const
+        { return currentState->phase; }
+
+        /**
+         * A method to evaluate the current position in O(1):
+         * the incrementally updated material and piece-square
+         * scores, tapered by game phase.
+         *
+         * @return the static evaluation, from the point of
+         * view of the player to move
+         */
+        [[nodiscard]]
+        constexpr int evaluate() const {
+            const int e = Evaluation::taper(
+                currentState->psq, currentState->phase
+            );
+            return currentPlayerAlliance == White ? e : -e;
+        }
+
+        /**
+         * A method to determine whether the player to move is
+         * in check.
+         *
+         * @return whether or not the current player's king is
+         * attacked
+         */
+        [[nodiscard]]
+        inline bool inCheck() const {
+            const Alliance us = currentPlayerAlliance;
+            return attackersTo(bitScanFwd(pieces[us][King]), allPieces) &
+                   pieces[~us][NullPT];
+        }
+
+        /**
+         * A method to determine whether the position could
+         * stand on a board in a game: the player who just
+         * moved is not in check, no pawn stands on the first
+         * or last rank, each castling right has its king and
+         * rook on their home squares, and an en passant square
+         * has a pawn that was just pushed past it. A parsed
+         * FEN must pass before it is searched or counted.
+         *
+         * @return whether or not the position is legal
+         */
+        [[nodiscard]]
+        inline bool isLegal() const {
+            const Alliance us = currentPlayerAlliance, them = ~us;
+            if (attackersTo(bitScanFwd(pieces[them][King]), allPieces) &
+                pieces[us][NullPT])
+                return false;
+            if ((pieces[White][Pawn] | pieces[Black][Pawn]) &
+                (Ranks[0] | Ranks[7]))
+                return false;
+            const auto home = [this](const Alliance a, const PieceType pt,
+                                     const int sq) {
+                return (pieces[a][pt] >> (unsigned) sq) & 1U;
+            };
+            if ((hasCastlingRights<White>() && !home(White, King, E1)) ||
+                (hasCastlingRights<Black>() && !home(Black, King, E8)) ||
+                (hasCastlingRights<White, KingSide>()  && !home(White, Rook, H1)) ||
+                (hasCastlingRights<White, QueenSide>() && !home(White, Rook, A1)) ||
+                (hasCastlingRights<Black, KingSide>()  && !home(Black, Rook, H8)) ||
+                (hasCastlingRights<Black, QueenSide>() && !home(Black, Rook, A8)))
+                return false;
+            const int ep = currentState->epSquare;
+            if (ep == NullSQ) return true;
+            // The pawn of the player who just moved stands on
+            // its fourth rank, with the two squares it crossed
+            // empty behind it.
+            const int behind = them == White ? -8 : 8;
+            return (them == White ? rankOf(ep) == 3 : rankOf(ep) == 4) &&
+                   home(them, Pawn, ep) &&
+                   !((allPieces >> (unsigned) (ep + behind)) & 1U) &&
+                   !((allPieces >> (unsigned) (ep + 2 * behind)) & 1U);
+        }
+
+        /**
+         * A method to compute the check information of the
+         * current node, for use with givesCheck().
+         *
+         * @return the check information of the current node
+         */
+        [[nodiscard]]
+        inline CheckInfo checkInfo() const {
+            const Alliance us = currentPlayerAlliance, them = ~us;
+            CheckInfo ci{};
+            const int ksq = bitScanFwd(pieces[them][King]);
+            ci.kingSquare           = ksq;
+            ci.checkSquares[Pawn]   = SquareToPawnAttacks[them][ksq];
+            ci.checkSquares[Knight] = SquareToKnightAttacks[ksq];
+            ci.checkSquares[Bishop] = attackBoard<Bishop>(allPieces, ksq);
+            ci.checkSquares[Rook]   = attackBoard<Rook>(allPieces, ksq);
+            ci.checkSquares[Queen]  =
+                ci.checkSquares[Bishop] | ci.checkSquares[Rook];
+            // Draw x-rays from our snipers to their king and
+            // keep our own lone blockers.
+            const uint64_t snipers =
+                (attackBoard<Rook>(0, ksq) &
+                (pieces[us][Rook]   | pieces[us][Queen])) |
+                (attackBoard<Bishop>(0, ksq) &
+                (pieces[us][Bishop] | pieces[us][Queen]));
+            for(uint64_t x = snipers; x; x &= x - 1) {
+                const uint64_t blocker =
+                    pathBoard(bitScanFwd(x), ksq) & allPieces;
+                if(!(blocker & (blocker - 1)))
+                    ci.discoverers |= blocker & pieces[us][NullPT];
+            }
+            return ci;
+        }
+
+        /**
+         * <summary>
+         *  <p><br/>
+         * A method to determine whether a legal move gives
+         * check, without applying it.
+         *  </p>
+         *  <p>
+         * Direct checks and discoveries cost a couple of
+         * lookups in the given CheckInfo. Promotions, en
+         * passant and castling, which change more than one
+         * square, fall back to magic lookups on the occupancy
+         * after the move.
+         *  </p>
+         * </summary>
+         *
+         * @param m  a legal move
+         * @param ci the check information of the current node
+         * @return whether or not the move gives check
+         */
+        [[nodiscard]]
+        inline bool givesCheck(const Move& m, const CheckInfo& ci) const {
+            const Alliance us = currentPlayerAlliance;
+            const int o = m.origin(), d = m.destination(),
+                      ksq = ci.kingSquare;
+            const uint64_t dBoard = SquareToBitBoard[d],
+                           kBoard = SquareToBitBoard[ksq];
+            if(m.isPromotion()) {
+                const uint64_t occ = allPieces ^ SquareToBitBoard[o];
+                const int pt = m.promotionPiece();
+                return (pt == Knight ? SquareToKnightAttacks[d] :
+                        pt == Bishop ? attackBoard<Bishop>(occ, d) :
+                        pt == Rook   ? attackBoard<Rook>(occ, d)   :
+                        attackBoard<Queen>(occ, d)) & kBoard ||
+                       ((ci.discoverers & SquareToBitBoard[o]) &&
+                       !(rayBoard(ksq, o) & dBoard));
+            }
+            const int moveType = m.moveType();
+            if(moveType == Castling) {
+                const Defaults* const x = us == White ?
+                    defaults<White>() : defaults<Black>();
+                const bool kingSide = x->kingSideMask & dBoard;
+                const int rookDestination = kingSide ?
+                    x->kingSideRookDestination : x->queenSideRookDestination;
+                const uint64_t occ = allPieces ^ SquareToBitBoard[o] ^ dBoard ^
+                    (kingSide ? x->kingSideRookMoveMask :
+                                x->queenSideRookMoveMask);
+                return attackBoard<Rook>(occ, rookDestination) & kBoard;
+            }
+            if(ci.checkSquares[mailbox[o]] & dBoard)
+                return true;
+            if((ci.discoverers & SquareToBitBoard[o]) &&
+               !(rayBoard(ksq, o) & dBoard))
+                return true;
+            if(moveType == EnPassant) {
+                const uint64_t occ = allPieces ^ SquareToBitBoard[o] ^
+                    dBoard ^ SquareToBitBoard[currentState->epSquare];
+                return (attackBoard<Rook>(occ, ksq) &
+                       (pieces[us][Rook] | pieces[us][Queen])) |
+                       (attackBoard<Bishop>(occ, ksq) &
+                       (pieces[us][Bishop] | pieces[us][Queen]));
+            }
+            return false;
+        }
+
+        /**
+         * A method to determine whether a legal move gives
+         * check, without applying it. Prefer the overload that
+         * takes a CheckInfo when testing many moves.
+         *
+         * @param m a legal move
+         * @return whether or not the move gives check
+         */
+        [[nodiscard]]
+        inline bool givesCheck(const Move& m) const
+        { return givesCheck(m, checkInfo()); }
+
+        /**
+         * <summary>
+         *  <p><br/>
+         * A method to compute the static exchange evaluation
+         * of a move: the material balance, in SeeValues, of
+         * the best sequence of captures on its destination.
+         *  </p>
+         *  <p>
+         * Both sides always recapture with their least
+         * valuable attacker and may stop at any point.
+         * Sliders hidden behind a capturing piece join the
+         * exchange as it is lifted. Pins are ignored.
+         *  </p>
+         * </summary>
+         *
+         * @param m the move to evaluate
+         * @return the expected material gain of the move
+         */
+        [[nodiscard]]
+        inline int see(const Move& m) const {
+            const int o = m.origin(), d = m.destination();
+            if(!m.isPromotion() && m.moveType() == Castling)
+                return 0;
+            int gain[32], n = 0;
+            uint64_t occ = allPieces ^ SquareToBitBoard[o];
+            PieceType onTarget = mailbox[o];
+            gain[0] = SeeValues[mailbox[d]];
+            if(m.isPromotion()) {
+                onTarget = PieceType(m.promotionPiece());
+                gain[0] += SeeValues[onTarget] - SeeValues[Pawn];
+            } else if(m.moveType() == EnPassant) {
+                occ ^= SquareToBitBoard[currentState->epSquare];
+                gain[0] = SeeValues[Pawn];
+            }
+            uint64_t attackers = attackersTo(d, occ) & occ;
+            Alliance side = currentPlayerAlliance;
+            for(;;) {
+                side = ~side;
+                const uint64_t mine = attackers & pieces[side][NullPT];
+                if(!mine) break;
+                ++n;
+                gain[n] = SeeValues[onTarget] - gain[n - 1];
+                onTarget = liftLeastValuable(d, mine, occ, attackers);
+            }
+            while(n > 0) {
+                gain[n - 1] = -std::max(-gain[n - 1], gain[n]);
+                --n;
+            }
+            return gain[0];
+        }
+
+        /**
+         * <summary>
+         *  <p><br/>
+         * A method to determine whether the static exchange
+         * evaluation of a move is at least the given
+         * threshold.
+         *  </p>
+         *  <p>
+         * This is cheaper than see(): it tracks one running
+         * balance instead of a swap list, and it stops as soon
+         * as the side to recapture can no longer change the
+         * outcome.
+         *  </p>
+         * </summary>
+         *
+         * @param m         the move to evaluate
+         * @param threshold the gain to test against
+         * @return whether or not see(m) >= threshold
+         */
+        [[nodiscard]]
+        inline bool seeGE(const Move& m, const int threshold) const {
+            const int o = m.origin(), d = m.destination();
+            if(!m.isPromotion() && m.moveType() == Castling)
+                return 0 >= threshold;
+            uint64_t occ = allPieces ^ SquareToBitBoard[o];
+            int captured = SeeValues[mailbox[d]],
+                mover    = SeeValues[mailbox[o]];
+            if(m.isPromotion()) {
+                captured += SeeValues[m.promotionPiece()] - SeeValues[Pawn];
+                mover     = SeeValues[m.promotionPiece()];
+            } else if(m.moveType() == EnPassant) {
+                occ ^= SquareToBitBoard[currentState->epSquare];
+                captured = SeeValues[Pawn];
+            }
+            // The balance if the opponent wins the mover.
+            int swap = captured - threshold;
+            if(swap < 0) return false;
+            swap = mover - swap;
+            if(swap <= 0) return true;
+            uint64_t attackers = attackersTo(d, occ) & occ;
+            Alliance side = currentPlayerAlliance;
+            int res = 1;
+            for(;;) {
+                side = ~side;
+                const uint64_t mine = attackers & pieces[side][NullPT];
+                if(!mine) break;
+                res ^= 1;
+                const PieceType pt =
+                    liftLeastValuable(d, mine, occ, attackers);
+                // A king may only capture when nothing
+                // recaptures.
+                if(pt == King)
+                    return (attackers & pieces[~side][NullPT]) ?
+                           res ^ 1 : res;
+                if((swap = SeeValues[pt] - swap) < res) break;
+            }
+            return res;
+        }
+
         [[nodiscard]]
         constexpr PieceType getPiece(const int square) const
         { return mailbox[square]; }
 
-        constexpr void applyMove(const Move& m, State& s) {
+        constexpr void applyMove(const Move& m) {
             return currentPlayerAlliance == White?
-                   applyMove<White>(m, s) :
-                   applyMove<Black>(m, s);
+                   applyMove<White>(m) :
+                   applyMove<Black>(m);
         }
 
         constexpr void retractMove(const Move& m) {
@@ -891,6 +1796,47 @@ namespace Charon {
                    retractMove<Black>(m) :
                    retractMove<White>(m);
         }
+
+        /**
+         * <summary>
+         *  <p><br/>
+         * A method to pass the turn. A State is pushed as for
+         * any move, the en passant square is cleared and the
+         * key is updated; no piece moves.
+         *  </p>
+         *  <p>
+         * The halfmove clock runs on, as for a quiet move,
+         * while the count of plies since a null move restarts,
+         * so that repetition scans never reach back across the
+         * null move. The caller must not pass while in check.
+         *  </p>
+         * </summary>
+         */
+        constexpr void applyNullMove() {
+            assert(currentState < history + MaxPly - 1);
+            State& state = currentState[1];
+            state.castlingRights = currentState->castlingRights;
+            state.epSquare       = NullSQ;
+            state.capturedPiece  = NullPT;
+            state.halfmoveClock  = currentState->halfmoveClock + 1;
+            state.pliesFromNull  = 0;
+            state.key            = currentState->key ^ Zobrist::Side ^
+                epKey();
+            state.pawnKey        = currentState->pawnKey;
+            state.psq            = currentState->psq;
+            state.phase          = currentState->phase;
+            state.delta.count    = 0;
+            currentState         = &state;
+            currentPlayerAlliance = ~currentPlayerAlliance;
+        }
+
+        /**
+         * A method to take back a null move.
+         */
+        constexpr void retractNullMove() {
+            --currentState;
+            currentPlayerAlliance = ~currentPlayerAlliance;
+        }
     };
 
 }
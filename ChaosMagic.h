@@ -20,6 +20,15 @@
 // Popcnt
 #define USE_POPCNT
 
+// AVX-512 - has vpcompressd and masked 16-bit
+// stores. Only enabled when the target cpu
+// supports the F, BW and VL subsets.
+#if defined(__AVX512F__)  && \
+    defined(__AVX512BW__) && \
+    defined(__AVX512VL__)
+#   define USE_AVX512
+#endif
+
 // If this is a Microsoft compiler,
 // include the Microsoft intrinsic library.
 #if defined(_MSC_VER)
@@ -46,6 +55,15 @@
 #   define PEXT(b, m) 0
 #endif
 
+// If AVX-512 is supported, set the HasAVX512
+// flag and include the intrinsic library.
+#if defined(USE_AVX512)
+#   include <immintrin.h>
+    constexpr bool HasAVX512 = true;
+#else
+    constexpr bool HasAVX512 = false;
+#endif
+
 #include <iostream>
 #include <memory>
 #include <cassert>
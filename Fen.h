@@ -32,10 +32,64 @@ namespace Charon::FenUtility {
     constexpr bool isLowerCase(const char c)
     { return c > '`' && c < '{'; }
 
+    constexpr bool isDigit(const char c)
+    { return c >= '0' && c <= '9'; }
+
+    constexpr int parseInt(const char*& c) {
+        int n = 0;
+        for (; isDigit(*c); ++c) n = n * 10 + (*c - '0');
+        return n;
+    }
+
+    /**
+     * A function to check that a string begins with a record
+     * that parseBoard can read safely: eight ranks of eight
+     * squares holding one king of each color, the side to
+     * move, castling rights and an en passant square. The
+     * move counters, EPD operations or anything else may
+     * follow. Whether the position could arise in a game is
+     * not checked.
+     *
+     * @param fen the string, terminated by a null character
+     * @return whether or not parseBoard can read the string
+     */
+    constexpr bool isValid(const char *const fen) {
+        const char *c = fen;
+        int kings[2] = { 0, 0 };
+        for (int rank = 0; rank < 8; ++rank) {
+            int files = 0;
+            for (; *c && *c != '/' && *c != ' '; ++c) {
+                if (*c > '0' && *c < '9') files += *c - '0';
+                else {
+                    const bool black = isLowerCase(*c);
+                    const int pt = find((char)(*c - (black? 32: 0)));
+                    if (pt < 0) return false;
+                    kings[black] += pt == King;
+                    ++files;
+                }
+                if (files > 8) return false;
+            }
+            if (files != 8 || *c++ != (rank < 7? '/': ' '))
+                return false;
+        }
+        if (kings[White] != 1 || kings[Black] != 1) return false;
+        const char a = *c;
+        if ((a != 'w' && a != 'b') || c[1] != ' ') return false;
+        c += 2;
+        if (*c == '-') ++c;
+        else {
+            const char *const rights = c;
+            for (; *c == 'K' || *c == 'Q' || *c == 'k' || *c == 'q'; ++c);
+            if (c == rights) return false;
+        }
+        if (*c++ != ' ') return false;
+        if (*c == '-') return true;
+        return *c >= 'a' && *c <= 'h' && c[1] == (a == 'w'? '6': '3');
+    }
+
     constexpr Board
-    parseBoard(const char *const fen,
-               State *const x) {
-        Board::Builder<Fen> b(*x);
+    parseBoard(const char *const fen) {
+        Board::Builder<Fen> b;
         const char *c = fen;
         for (int sq = A8; sq >= H1; ++c) {
             for (; *c != '/' && *c != ' '; ++c) {
@@ -66,9 +120,30 @@ namespace Charon::FenUtility {
                 [*(c + 1) - '1'] +
                 (a == 'w'? -8 : 8))
             );
-
+        c += *c == '-'? 1: 2;
+        for (; *c == ' '; ++c);
+        if (isDigit(*c)) {
+            b.setHalfmoveClock(parseInt(c));
+            for (; *c == ' '; ++c);
+            if (isDigit(*c))
+                b.setFullmoveNumber(parseInt(c));
+        }
         return b.build();
     }
+
+    /**
+     * A function to check that a string holds a position that
+     * may be searched or counted: a record that isValid
+     * accepts, of a board that isLegal.
+     *
+     * @param fen the string, terminated by a null character
+     * @return whether or not the string holds a legal
+     * position
+     *
+     * @see Board::isLegal()
+     */
+    inline bool isLegal(const char *const fen)
+    { return isValid(fen) && parseBoard(fen).isLegal(); }
 }
 
 
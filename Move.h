@@ -167,6 +167,17 @@ namespace Charon {
         constexpr int origin() const
         { return (manifest & From) >> 6U; }
 
+        /**
+         * A method to expose the origin and destination of
+         * this move together, as a 12-bit index for tables
+         * such as butterfly histories.
+         *
+         * @return the origin and destination of this move.
+         */
+        [[nodiscard]]
+        constexpr int fromTo() const
+        { return manifest & (From | To); }
+
         /**
          * A method to expose the type of this move.
          * The client should determine whether or not the
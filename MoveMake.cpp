@@ -3,6 +3,7 @@
 //
 
 #include "MoveMake.h"
+#include "QuadBoard.h"
 
 namespace Charon {
     namespace {
@@ -12,14 +13,15 @@ namespace Charon {
          * by high bits in the given bitboard are safe to travel to.
          *
          * @tparam A    the alliance to consider
+         * @tparam B    the board type
          * @param board the current game board
          * @param d     the bitboard to check for safe squares
          * @return      whether or not all squares represented
          *              by high bits in the given bitboard are
          *              safe to travel to
          */
-        template <Alliance A> [[nodiscard]]
-        inline bool safeSquares(Board* const board,
+        template <Alliance A, class B> [[nodiscard]]
+        inline bool safeSquares(B* const board,
                                 const uint64_t destinations) {
             static_assert(A == White || A == Black);
             for (uint64_t d = destinations; d; d &= d - 1)
@@ -28,6 +30,70 @@ namespace Charon {
             return true;
         }
 
+        /**
+         * <summary>
+         *  <p><br/>
+         * A function to serialise a destination bitboard into
+         * a list of moves. Each high bit d in the given bitboard
+         * becomes a move with the manifest (base + S * d).
+         *  </p>
+         *  <p>
+         * A step of 1 with a base of (origin << 6) serialises
+         * the destinations of a single piece. A step of 65
+         * (64 + 1) with a base of (offset << 6) serialises pawn
+         * targets whose origins lie a fixed offset away from
+         * their destinations.
+         *  </p>
+         *  <p>
+         * When AVX-512 is available, each 16-square quarter of
+         * the bitboard is expanded at once: the lane indices
+         * selected by the quarter are packed with vpcompressd,
+         * narrowed to 16 bits, and written as a single masked
+         * block. Otherwise, the bits are popped one at a time.
+         *  </p>
+         * </summary>
+         *
+         * @tparam S     the step (1 or 65)
+         * @param moves  a pointer to a list to populate
+         *               with moves
+         * @param d      the destination bitboard
+         * @param base   the manifest of a move to square 0
+         * @return       a pointer to the next empty
+         *               index in the array that holds
+         *               the moves list
+         */
+        template<int S>
+        inline Move* serialize(Move* moves, uint64_t d, const int base) {
+            static_assert(S == 1 || S == 65);
+#       if defined(USE_AVX512)
+            const __m512i lanes = _mm512_set_epi32(
+                15, 14, 13, 12, 11, 10, 9, 8,
+                7,  6,  5,  4,  3,  2,  1, 0
+            );
+            __m512i v = _mm512_add_epi32(_mm512_set1_epi32(base),
+                S == 1 ? lanes : _mm512_add_epi32(
+                    _mm512_slli_epi32(lanes, 6), lanes
+                ));
+            const __m512i quarter = _mm512_set1_epi32(S << 4);
+            for (; d; d >>= 16U, v = _mm512_add_epi32(v, quarter)) {
+                const auto q = (__mmask16) d;
+                if (!q) continue;
+                const __m256i w = _mm512_cvtepi32_epi16(
+                    _mm512_maskz_compress_epi32(q, v)
+                );
+                const int n = highBitCount(q);
+                _mm256_mask_storeu_epi16(
+                    moves, (__mmask16) ((1U << n) - 1U), w
+                );
+                moves += n;
+            }
+#       else
+            for (; d; d &= d - 1)
+                *moves++ = Move(base + S * bitScanFwd(d));
+#       endif
+            return moves;
+        }
+
         /**
          * A function to make promotions and under-promotions.
          *
@@ -52,6 +118,9 @@ namespace Charon {
          *
          * @tparam A        the alliance
          * @tparam FT       the filter type
+         * @tparam EP       whether or not the en passant
+         *                  square may be set
+         * @tparam B        the board type
          * @param board     the board to use
          * @param checkMask the check mask to use in the
          *                  case of check or double check
@@ -65,8 +134,9 @@ namespace Charon {
          *                  index in the array that holds
          *                  the moves list
          */
-        template <Alliance A, FilterType FT>
-        Move* makePawnMoves(Board* const board,
+        template <Alliance A, FilterType FT, bool EP, class B>
+        [[gnu::always_inline]] inline
+        Move* makePawnMoves(B* const board,
                             const uint64_t checkMask,
                             const uint64_t kingGuard,
                             const int kingSquare,
@@ -80,11 +150,11 @@ namespace Charon {
             constexpr const Defaults* const x = defaults<us>();
 
             // Initialize constants.
-            const uint64_t enemies         = board->getPieces<them>() & checkMask,
+            const uint64_t enemies         = board->template getPieces<them>() & checkMask,
                            allPieces       = board->getAllPieces(),
                            emptySquares    = ~allPieces,
-                           pawns           = board->getPieces<us, Pawn>(),
-                           king            = board->getPieces<us, King>(),
+                           pawns           = board->template getPieces<us, Pawn>(),
+                           king            = board->template getPieces<us, King>(),
                            freePawns       = pawns & ~kingGuard,
                            pinnedPawns     = pawns & kingGuard,
                            freeLowPawns    = freePawns & ~x->prePromotionMask,
@@ -108,17 +178,11 @@ namespace Charon {
                 p2 &= checkMask;
 
                 // Make moves from passive one-square targets.
-                for (int d; p1; p1 &= p1 - 1) {
-                    d = bitScanFwd(p1);
-                    *moves++ = Move::make((d + x->down), d);
-                }
+                moves = serialize<65>(moves, p1, x->down * 64);
 
                 // Make moves from passive two-square targets.
-                for (int d; p2; p2 &= p2 - 1) {
-                    d = bitScanFwd(p2);
-                    *moves++ =
-                        Move::make<PawnJump>((d + x->down + x->down), d);
-                }
+                moves = serialize<65>(moves, p2,
+                    (PawnJump << 12U) + (x->down + x->down) * 64);
             }
 
             // If generating all moves or attack moves, continue,
@@ -138,16 +202,10 @@ namespace Charon {
                         & enemies;
 
                 // Make moves from aggressive right targets.
-                for (int d; ar; ar &= ar - 1) {
-                    d = bitScanFwd(ar);
-                    *moves++ = Move::make(d + x->downLeft, d);
-                }
+                moves = serialize<65>(moves, ar, x->downLeft * 64);
 
                 // Make moves from aggressive left targets.
-                for (int d; al; al &= al - 1) {
-                    d = bitScanFwd(al);
-                    *moves++ = Move::make(d + x->downRight, d);
-                }
+                moves = serialize<65>(moves, al, x->downRight * 64);
             }
 
             // Generate single and double pushes for pinned low pawns,
@@ -322,8 +380,9 @@ namespace Charon {
                 }
             }
 
-            // If the filter type is not passive, continue.
-            if(FT == Passive) return moves;
+            // If the filter type is not passive and en passant
+            // must be considered, continue.
+            if(FT == Passive || !EP) return moves;
 
             // Find the en passant square, if any.
             const int enPassantSquare = board->getEpSquare();
@@ -366,8 +425,8 @@ namespace Charon {
             if (king & x->enPassantRank) {
                 // Find the snipers on the en passant rank.
                 const uint64_t snipers =
-                        (board->getPieces<them, Queen>() |
-                         board->getPieces<them, Rook>()) &
+                        (board->template getPieces<them, Queen>() |
+                         board->template getPieces<them, Rook>()) &
                          x->enPassantRank;
 
                 // Check to see if the en passant pawn
@@ -398,8 +457,8 @@ namespace Charon {
 
                 const uint64_t diagonalSnipers =
                     (attackBoard<Bishop>(0, kingSquare) &
-                    (board->getPieces<them, Bishop>() |
-                     board->getPieces<them, Queen>()));
+                    (board->template getPieces<them, Bishop>() |
+                     board->template getPieces<them, Queen>()));
 
                 // Check to see if the en passant pawn
                 // is between any of the snipers and the king
@@ -446,6 +505,7 @@ namespace Charon {
          *
          * @tparam A        the alliance to consider
          * @tparam PT       the piece type to consider
+         * @tparam B        the board type
          * @param board     the current game board
          * @param kingGuard the king guard for the given
          *                  alliance
@@ -456,8 +516,9 @@ namespace Charon {
          *                  index in the array that holds
          *                  the moves list
          */
-        template<Alliance A, PieceType PT>
-        Move* makeMoves(Board* const board,
+        template<Alliance A, PieceType PT, class B>
+        [[gnu::always_inline]] inline
+        Move* makeMoves(B* const board,
                                const uint64_t kingGuard,
                                const uint64_t filter,
                                const int kingSquare,
@@ -468,7 +529,7 @@ namespace Charon {
             constexpr const Alliance us = A;
 
             // Initialize constants.
-            const uint64_t pieceBoard = board->getPieces<us, PT>(),
+            const uint64_t pieceBoard = board->template getPieces<us, PT>(),
                            freePieces = pieceBoard & ~kingGuard,
                            allPieces  = board->getAllPieces();
 
@@ -481,13 +542,12 @@ namespace Charon {
 
                 // Look up the attack board using the origin
                 // square and intersect with the filter.
-                uint64_t ab = attackBoard<PT>(allPieces, origin)
+                const uint64_t ab = attackBoard<PT>(allPieces, origin)
                     & filter;
 
-                // Traverse through the legal
-                // move board and add all legal moves.
-                for (; ab; ab &= ab - 1)
-                    *moves++ = Move::make(origin, bitScanFwd(ab));
+                // Serialise the legal move board and add all
+                // legal moves.
+                moves = serialize<1>(moves, ab, origin << 6U);
             }
 
             // Knight pinned pieces are trapped. They
@@ -512,14 +572,13 @@ namespace Charon {
 
                     // Lookup the attack board and intersect with
                     // the filter and the pinning ray.
-                    uint64_t ab =
+                    const uint64_t ab =
                         attackBoard<PT>(allPieces, origin)
                             & filter & rayBoard(kingSquare, origin);
 
-                    // Traverse through the legal
-                    // move board and add all legal moves.
-                    for (; ab; ab &= ab - 1)
-                        *moves++ = Move::make(origin, bitScanFwd(ab));
+                    // Serialise the legal move board and add all
+                    // legal moves.
+                    moves = serialize<1>(moves, ab, origin << 6U);
 
                     n &= n - 1;
                 } while (n);
@@ -529,55 +588,68 @@ namespace Charon {
         }
 
         /**
-         * A function to generate moves for every piece type.
+         * <summary>
+         *  <p><br/>
+         * A function to generate moves for every piece type,
+         * specialised for a single position class. The class
+         * is fixed at compile time by the check type, whether
+         * or not castling must be considered and whether or
+         * not en passant must be considered, so that each
+         * specialisation runs straight-line code with the
+         * irrelevant branches folded away.
+         *  </p>
+         * </summary>
          *
-         * @tparam A    the alliance to consider
-         * @tparam FT   the filter type
-         * @param board the current game board
-         * @param moves a pointer to the list to populate
+         * @tparam A         the alliance to consider
+         * @tparam FT        the filter type
+         * @tparam CT        the check type of our king
+         * @tparam CR        whether or not castling moves
+         *                   must be considered
+         * @tparam EP        whether or not en passant moves
+         *                   must be considered
+         * @tparam B         the board type
+         * @param board      the current game board
+         * @param moves      a pointer to the list to populate
+         * @param ksq        the square of our king
+         * @param checkBoard a bitboard of all pieces that
+         *                   attack our king
+         * @return           the number of moves generated
          */
-        template <Alliance A, FilterType FT>
-        int makeMoves(Board* const board, Move* moves) {
+        template <Alliance A, FilterType FT,
+                  CheckType CT, bool CR, bool EP, class B>
+        int makeMoves(B* const board, Move* moves,
+                      const int ksq, const uint64_t checkBoard) {
             static_assert(A == White || A == Black);
             static_assert(FT >= Aggressive && FT <= All);
+            static_assert(CT >= None && CT <= DoubleCheck);
 
             const Move* const initialMove = moves;
             constexpr const Alliance us = A, them = ~us;
 
             // Initialize constants.
             const uint64_t allPieces     = board->getAllPieces(),
-                           ourPieces     = board->getPieces<us>(),
-                           theirPieces   = board->getPieces<them>(),
+                           ourPieces     = board->template getPieces<us>(),
+                           theirPieces   = board->template getPieces<them>(),
                            partialFilter = FT == All?     ~ourPieces :
                                            FT == Passive? ~allPieces :
-                                                          theirPieces,
-                           king          = board->getPieces<us, King>();
+                                                          theirPieces;
 
             // Get the board defaults for our alliance.
             constexpr const Defaults* const x = defaults<us>();
 
-            // Find the king square.
-            const int ksq = bitScanFwd(king);
-
-            // Find all pieces that attack our king.
-            const uint64_t checkBoard = attacksOn<us, King>(board, ksq);
-
-            // Calculate the check type for our king.
-            const CheckType checkType = calculateCheck(checkBoard);
-
             // If our king is in double check, then only king moves
             // should be considered.
-            if (checkType != DoubleCheck) {
+            if (CT != DoubleCheck) {
                 uint64_t blockers = 0;
                 const uint64_t theirQueens =
-                        board->getPieces<them, Queen>();
+                        board->template getPieces<them, Queen>();
 
                 // Find the sniper pieces.
                 const uint64_t snipers =
                         (attackBoard<Rook>(0, ksq) &
-                        (board->getPieces<them, Rook>() | theirQueens)) |
+                        (board->template getPieces<them, Rook>() | theirQueens)) |
                         (attackBoard<Bishop>(0, ksq) &
-                        (board->getPieces<them, Bishop>() | theirQueens));
+                        (board->template getPieces<them, Bishop>() | theirQueens));
 
                 // Iterate through the snipers and draw paths to the king,
                 // using these paths as an x-ray to find the blockers.
@@ -592,7 +664,7 @@ namespace Charon {
                 // If our king is in single check, determine the path between the
                 // king and his attacker.
                 const uint64_t kingGuard = ourPieces & blockers,
-                               checkPath = (checkType == Check ? pathBoard(
+                               checkPath = (CT == Check ? pathBoard(
                                       ksq, bitScanFwd(checkBoard)
                                ) | checkBoard : FullBoard),
                 // A filter to limit all pieces to blocking
@@ -603,7 +675,7 @@ namespace Charon {
                                fullFilter = partialFilter & checkPath;
 
                 // Make non-king moves.
-                moves = makePawnMoves<us, FT>(board, checkPath, kingGuard,  ksq, moves);
+                moves = makePawnMoves<us, FT, EP>(board, checkPath, kingGuard,  ksq, moves);
                 moves = makeMoves<us,   Rook>(board, kingGuard, fullFilter, ksq, moves);
                 moves = makeMoves<us, Knight>(board, kingGuard, fullFilter, ksq, moves);
                 moves = makeMoves<us, Bishop>(board, kingGuard, fullFilter, ksq, moves);
@@ -621,12 +693,13 @@ namespace Charon {
             // If the filter type is aggressive, then castling moves
             // are irrelevant. If we don't have castling rights or
             // if we are in check, then castling moves are illegal.
-            if (FT == Aggressive || checkType != None)
+            if (FT == Aggressive || CT != None || !CR ||
+                !board->template hasCastlingRights<us>())
                 return (moves - initialMove);
 
             // Generate king-side castle.
             if(!(x->kingSideMask & allPieces) &&
-                board->hasCastlingRights<us, KingSide>() &&
+                board->template hasCastlingRights<us, KingSide>() &&
                 safeSquares<us>(board, x->kingSideCastlePath))
                 *moves++ = Move::make<Castling>(
                         ksq, x->kingSideDestination
@@ -634,7 +707,7 @@ namespace Charon {
 
             // Generate queen-side castle.
             if(!(x->queenSideMask & allPieces) &&
-                board->hasCastlingRights<us, QueenSide>() &&
+                board->template hasCastlingRights<us, QueenSide>() &&
                 safeSquares<us>(board, x->queenSideCastlePath))
                 *moves++ = Move::make<Castling>(
                         ksq, x->queenSideDestination
@@ -642,11 +715,63 @@ namespace Charon {
 
             return (moves - initialMove);
         }
+
+        /**
+         * <summary>
+         *  <p><br/>
+         * A function to generate moves for every piece type.
+         * The position class of the current node is determined
+         * once, here, and the matching specialisation is picked
+         * through a small jump table.
+         *  </p>
+         *  <p>
+         * Only the check type selects a specialisation. Single
+         * and double check rule out castling and most of the
+         * en passant logic at compile time, while quiet nodes
+         * test their castling rights and en passant square at
+         * run time. Splitting quiet nodes further by castling
+         * rights and en passant square multiplies the inlined
+         * generator code and measured slower in perft.
+         *  </p>
+         * </summary>
+         *
+         * @tparam A    the alliance to consider
+         * @tparam FT   the filter type
+         * @tparam B    the board type
+         * @param board the current game board
+         * @param moves a pointer to the list to populate
+         */
+        template <Alliance A, FilterType FT, class B>
+        inline int makeMoves(B* const board, Move* const moves) {
+            static_assert(A == White || A == Black);
+            static_assert(FT >= Aggressive && FT <= All);
+
+            constexpr const Alliance us = A;
+
+            // Find the king square.
+            const int ksq = bitScanFwd(board->template getPieces<us, King>());
+
+            // Find all pieces that attack our king.
+            const uint64_t checkBoard = attacksOn<us, King>(board, ksq);
+
+            // Classify the position and jump.
+            switch (calculateCheck(checkBoard)) {
+                case None:
+                    return makeMoves<us, FT, None, true, true>
+                        (board, moves, ksq, checkBoard);
+                case Check:
+                    return makeMoves<us, FT, Check, false, true>
+                        (board, moves, ksq, checkBoard);
+                default:
+                    return makeMoves<us, FT, DoubleCheck, false, false>
+                        (board, moves, ksq, checkBoard);
+            }
+        }
     } // namespace (anon)
 
     namespace MoveFactory {
-        template<FilterType FT>
-        inline int generateMoves(Board *const board, Move* const moves) {
+        template<FilterType FT, class B>
+        inline int generateMoves(B* const board, Move* const moves) {
             static_assert(FT >= Aggressive && FT <= All);
             return board->currentPlayer() == White ?
                    makeMoves<White, FT>(board, moves) :
@@ -657,5 +782,8 @@ namespace Charon {
         template int generateMoves<Aggressive>(Board*, Move*);
         template int generateMoves<Passive>(Board*, Move*);
         template int generateMoves<All>(Board*, Move*);
+        template int generateMoves<Aggressive>(QuadBoard*, Move*);
+        template int generateMoves<Passive>(QuadBoard*, Move*);
+        template int generateMoves<All>(QuadBoard*, Move*);
     }
 } // namespace Charon
\ No newline at end of file
@@ -21,29 +21,30 @@ namespace Charon {
      * @tparam A    the alliance of the piece
      *              on the square under attack
      * @tparam PT   the piece type
+     * @tparam B    the board type
      * @param board the current game board
      * @param sq    the square under attack
      */
-    template<Alliance A, PieceType PT> [[nodiscard]]
-    constexpr uint64_t attacksOn(Board* const board, const int sq) {
+    template<Alliance A, PieceType PT, class B> [[nodiscard]]
+    constexpr uint64_t attacksOn(B* const board, const int sq) {
         static_assert(A == White || A == Black);
         static_assert(PT >= Pawn && PT <= NullPT);
 
         constexpr const Alliance us = A, them = ~us;
 
         // Initialize constants.
-        const uint64_t theirQueens = board->getPieces<them, Queen>(),
-                       target      = PT == NullPT? 0: board->getPieces<us, PT>(),
+        const uint64_t theirQueens = board->template getPieces<them, Queen>(),
+                       target      = PT == NullPT? 0: board->template getPieces<us, PT>(),
                        allPieces   = board->getAllPieces() & ~target;
 
         // Calculate and return a bitboard representing all attackers.
         return (attackBoard<Rook>(allPieces, sq)   &
-               (board->getPieces<them, Rook>()   | theirQueens)) |
+               (board->template getPieces<them, Rook>()   | theirQueens)) |
                (attackBoard<Bishop>(allPieces, sq) &
-               (board->getPieces<them, Bishop>() | theirQueens)) |
-               (SquareToKnightAttacks[sq]   & board->getPieces<them, Knight>()) |
-               (SquareToPawnAttacks[us][sq] & board->getPieces<them, Pawn>())   |
-               (SquareToKingAttacks[sq]     & board->getPieces<them, King>());
+               (board->template getPieces<them, Bishop>() | theirQueens)) |
+               (SquareToKnightAttacks[sq]   & board->template getPieces<them, Knight>()) |
+               (SquareToPawnAttacks[us][sq] & board->template getPieces<them, Pawn>())   |
+               (SquareToKingAttacks[sq]     & board->template getPieces<them, King>());
     }
 
     /**
@@ -102,11 +103,12 @@ namespace Charon {
          * </summary>
          *
          * @tparam FT the filter type
+         * @tparam B  the board type (Board or QuadBoard)
          * @param board the current game board
          * @param moves an empty list of moves
          */
-        template<FilterType FT>
-        int generateMoves(Board*, Move*);
+        template<FilterType FT, class B>
+        int generateMoves(B*, Move*);
     }
 }
 
@@ -0,0 +1,511 @@
+//
+// Created by agent on 10/19/2026.
+//
+
+#include "Nnue.h"
+#include <cstdio>
+#ifdef WIN32
+#include <new>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#if defined(__AVX2__) || defined(__SSSE3__)
+#include <immintrin.h>
+#endif
+
+namespace Charon::Nnue {
+    namespace {
+
+        static_assert(sizeof(Header) == 64);
+
+        /** The loaded network. */
+        Network net;
+
+        /** The mapped network file, or nullptr. */
+        void* mapping = nullptr;
+
+        /** The size of the mapped network file. */
+        size_t mappingSize = 0;
+
+        /**
+         * A function to free the memory of a network file.
+         *
+         * @param base the start of the file's memory
+         * @param size the size of the file
+         */
+        inline void release(void* const base, const size_t size) {
+#ifdef WIN32
+            (void) size;
+            ::operator delete(base, std::align_val_t(64));
+#else
+            munmap(base, size);
+#endif
+        }
+
+        /**
+         * The most feature changes worth applying to an
+         * Accumulator before a refresh is cheaper.
+         */
+        constexpr int MaxChanges = 32;
+
+        /**
+         * A function to find the square of a king.
+         *
+         * @param board the board
+         * @param p     the alliance of the king
+         * @return the square of the king
+         */
+        inline int kingSquare(const Board& board, const int p) {
+            return bitScanFwd(p == White ?
+                board.getPieces<White, King>() :
+                board.getPieces<Black, King>());
+        }
+
+        /**
+         * A function to find the HalfKP feature of a piece on a
+         * square, from a perspective. Black's perspective sees
+         * the board flipped vertically, so that both sides
+         * share weights.
+         *
+         * @param p     the perspective
+         * @param king  the square of the perspective's king
+         * @param piece the piece, as alliance * 6 + type
+         * @param sq    the square of the piece
+         * @return the feature index
+         */
+        constexpr int feature(const int p, const int king,
+                              const int piece, const int sq) {
+            const int flip = p == White ? 0 : 56,
+                      a = piece / 6, pt = piece % 6;
+            return (king ^ flip) * PieceSquares +
+                   ((a != p) * 5 + pt) * BoardLength + (sq ^ flip);
+        }
+
+        /**
+         * A function to look up the weight row of a feature.
+         *
+         * @param f the feature index
+         * @return the feature's L1 weights
+         */
+        inline const int16_t* row(const int f)
+        { return net.featureWeights + (size_t) f * L1; }
+
+#if defined(__AVX2__)
+
+        /**
+         * A function to set an accumulator to a source plus some
+         * weight rows and minus others. The accumulator is
+         * walked in blocks of eight 256-bit registers, so that
+         * each block is loaded and stored only once.
+         *
+         * @param dst  the accumulator to write
+         * @param src  the accumulator or biases to start from
+         * @param adds the rows to add
+         * @param na   the number of rows to add
+         * @param subs the rows to subtract
+         * @param ns   the number of rows to subtract
+         */
+        inline void addSub(int16_t* const dst, const int16_t* const src,
+                           const int16_t* const* const adds, const int na,
+                           const int16_t* const* const subs, const int ns) {
+            constexpr int Registers = 8, Block = Registers * 16;
+            static_assert(L1 % Block == 0);
+            for (int b = 0; b < L1; b += Block) {
+                __m256i r[Registers];
+                for (int k = 0; k < Registers; ++k)
+                    r[k] = _mm256_load_si256((const __m256i*) (src + b) + k);
+                for (int i = 0; i < na; ++i)
+                    for (int k = 0; k < Registers; ++k)
+                        r[k] = _mm256_add_epi16(r[k],
+                            _mm256_load_si256((const __m256i*) (adds[i] + b) + k));
+                for (int i = 0; i < ns; ++i)
+                    for (int k = 0; k < Registers; ++k)
+                        r[k] = _mm256_sub_epi16(r[k],
+                            _mm256_load_si256((const __m256i*) (subs[i] + b) + k));
+                for (int k = 0; k < Registers; ++k)
+                    _mm256_store_si256((__m256i*) (dst + b) + k, r[k]);
+            }
+        }
+
+        /**
+         * A function to clamp an accumulator to [0, 127] and
+         * narrow it to bytes.
+         *
+         * @param in  the accumulator
+         * @param out the L1 bytes to write
+         */
+        inline void clip(const int16_t* const in, uint8_t* const out) {
+            const __m256i max = _mm256_set1_epi8(127);
+            for (int i = 0; i < L1; i += 32) {
+                const __m256i a = _mm256_load_si256((const __m256i*) (in + i)),
+                              b = _mm256_load_si256((const __m256i*) (in + i + 16));
+                // packus interleaves the 128-bit halves of its
+                // operands; the permute puts them back in order.
+                const __m256i x = _mm256_permute4x64_epi64(
+                    _mm256_packus_epi16(a, b), 0xD8
+                );
+                _mm256_store_si256((__m256i*) (out + i),
+                                   _mm256_min_epu8(x, max));
+            }
+        }
+
+        /**
+         * A function to take the dot product of unsigned byte
+         * activations and signed byte weights.
+         *
+         * @param in the activations, at most 127 each
+         * @param w  the weights
+         * @param n  the length, a multiple of 32
+         * @return the dot product
+         */
+        inline int32_t dot(const uint8_t* const in, const int8_t* const w,
+                           const int n) {
+            const __m256i ones = _mm256_set1_epi16(1);
+            __m256i sum = _mm256_setzero_si256();
+            for (int i = 0; i < n; i += 32) {
+                // Pairs of products fit in 16 bits, since no
+                // activation exceeds 127.
+                const __m256i p = _mm256_maddubs_epi16(
+                    _mm256_loadu_si256((const __m256i*) (in + i)),
+                    _mm256_loadu_si256((const __m256i*) (w + i))
+                );
+                sum = _mm256_add_epi32(sum, _mm256_madd_epi16(p, ones));
+            }
+            __m128i s = _mm_add_epi32(_mm256_castsi256_si128(sum),
+                                      _mm256_extracti128_si256(sum, 1));
+            s = _mm_add_epi32(s, _mm_shuffle_epi32(s, 0x4E));
+            s = _mm_add_epi32(s, _mm_shuffle_epi32(s, 0xB1));
+            return _mm_cvtsi128_si32(s);
+        }
+
+        /**
+         * A function to take the dot products of unsigned byte
+         * activations with four rows of signed byte weights at
+         * once, sharing each load of the activations.
+         *
+         * @param in the activations, at most 127 each
+         * @param w  the first of four consecutive weight rows
+         * @param n  the length of a row, a multiple of 32
+         * @return the four dot products, in row order
+         */
+        inline __m128i dot4(const uint8_t* const in, const int8_t* const w,
+                            const int n) {
+            const __m256i ones = _mm256_set1_epi16(1);
+            __m256i s[4] = {
+                _mm256_setzero_si256(), _mm256_setzero_si256(),
+                _mm256_setzero_si256(), _mm256_setzero_si256()
+            };
+            for (int i = 0; i < n; i += 32) {
+                const __m256i x = _mm256_loadu_si256((const __m256i*) (in + i));
+                for (int r = 0; r < 4; ++r)
+                    s[r] = _mm256_add_epi32(s[r], _mm256_madd_epi16(
+                        _mm256_maddubs_epi16(x, _mm256_loadu_si256(
+                            (const __m256i*) (w + (size_t) r * n + i))),
+                        ones
+                    ));
+            }
+            const __m256i h = _mm256_hadd_epi32(
+                _mm256_hadd_epi32(s[0], s[1]),
+                _mm256_hadd_epi32(s[2], s[3])
+            );
+            return _mm_add_epi32(_mm256_castsi256_si128(h),
+                                 _mm256_extracti128_si256(h, 1));
+        }
+
+#elif defined(__SSSE3__)
+
+        inline void addSub(int16_t* const dst, const int16_t* const src,
+                           const int16_t* const* const adds, const int na,
+                           const int16_t* const* const subs, const int ns) {
+            constexpr int Registers = 8, Block = Registers * 8;
+            static_assert(L1 % Block == 0);
+            for (int b = 0; b < L1; b += Block) {
+                __m128i r[Registers];
+                for (int k = 0; k < Registers; ++k)
+                    r[k] = _mm_load_si128((const __m128i*) (src + b) + k);
+                for (int i = 0; i < na; ++i)
+                    for (int k = 0; k < Registers; ++k)
+                        r[k] = _mm_add_epi16(r[k],
+                            _mm_load_si128((const __m128i*) (adds[i] + b) + k));
+                for (int i = 0; i < ns; ++i)
+                    for (int k = 0; k < Registers; ++k)
+                        r[k] = _mm_sub_epi16(r[k],
+                            _mm_load_si128((const __m128i*) (subs[i] + b) + k));
+                for (int k = 0; k < Registers; ++k)
+                    _mm_store_si128((__m128i*) (dst + b) + k, r[k]);
+            }
+        }
+
+        inline void clip(const int16_t* const in, uint8_t* const out) {
+            const __m128i max = _mm_set1_epi8(127);
+            for (int i = 0; i < L1; i += 16) {
+                const __m128i x = _mm_packus_epi16(
+                    _mm_load_si128((const __m128i*) (in + i)),
+                    _mm_load_si128((const __m128i*) (in + i + 8))
+                );
+                _mm_store_si128((__m128i*) (out + i), _mm_min_epu8(x, max));
+            }
+        }
+
+        inline int32_t dot(const uint8_t* const in, const int8_t* const w,
+                           const int n) {
+            const __m128i ones = _mm_set1_epi16(1);
+            __m128i sum = _mm_setzero_si128();
+            for (int i = 0; i < n; i += 16) {
+                const __m128i p = _mm_maddubs_epi16(
+                    _mm_loadu_si128((const __m128i*) (in + i)),
+                    _mm_loadu_si128((const __m128i*) (w + i))
+                );
+                sum = _mm_add_epi32(sum, _mm_madd_epi16(p, ones));
+            }
+            sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0x4E));
+            sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0xB1));
+            return _mm_cvtsi128_si32(sum);
+        }
+
+        inline __m128i dot4(const uint8_t* const in, const int8_t* const w,
+                            const int n) {
+            const __m128i ones = _mm_set1_epi16(1);
+            __m128i s[4] = {
+                _mm_setzero_si128(), _mm_setzero_si128(),
+                _mm_setzero_si128(), _mm_setzero_si128()
+            };
+            for (int i = 0; i < n; i += 16) {
+                const __m128i x = _mm_loadu_si128((const __m128i*) (in + i));
+                for (int r = 0; r < 4; ++r)
+                    s[r] = _mm_add_epi32(s[r], _mm_madd_epi16(
+                        _mm_maddubs_epi16(x, _mm_loadu_si128(
+                            (const __m128i*) (w + (size_t) r * n + i))),
+                        ones
+                    ));
+            }
+            return _mm_hadd_epi32(_mm_hadd_epi32(s[0], s[1]),
+                                  _mm_hadd_epi32(s[2], s[3]));
+        }
+
+#else
+
+        inline void addSub(int16_t* const dst, const int16_t* const src,
+                           const int16_t* const* const adds, const int na,
+                           const int16_t* const* const subs, const int ns) {
+            for (int j = 0; j < L1; ++j) {
+                int16_t v = src[j];
+                for (int i = 0; i < na; ++i) v += adds[i][j];
+                for (int i = 0; i < ns; ++i) v -= subs[i][j];
+                dst[j] = v;
+            }
+        }
+
+        inline void clip(const int16_t* const in, uint8_t* const out) {
+            for (int j = 0; j < L1; ++j)
+                out[j] = in[j] < 0 ? 0 : in[j] > 127 ? 127 : in[j];
+        }
+
+        inline int32_t dot(const uint8_t* const in, const int8_t* const w,
+                           const int n) {
+            int32_t sum = 0;
+            for (int i = 0; i < n; ++i) sum += in[i] * w[i];
+            return sum;
+        }
+
+#endif
+
+        /**
+         * A function to run a dense layer with a clipped
+         * activation.
+         *
+         * @param in      the input activations
+         * @param n       the number of inputs
+         * @param weights the weights, one row of n per output
+         * @param biases  the biases, one per output
+         * @param out     the output activations to write
+         * @param m       the number of outputs
+         */
+        inline void dense(const uint8_t* const in, const int n,
+                          const int8_t* const weights,
+                          const int32_t* const biases,
+                          uint8_t* const out, const int m) {
+#if defined(__AVX2__) || defined(__SSSE3__)
+            // Four outputs at a time, clamped by saturating
+            // packs down to bytes.
+            for (int o = 0; o < m; o += 4) {
+                const __m128i s = _mm_srai_epi32(_mm_add_epi32(
+                    dot4(in, weights + (size_t) o * n, n),
+                    _mm_loadu_si128((const __m128i*) (biases + o))
+                ), WeightShift);
+                const __m128i c = _mm_min_epu8(_mm_packus_epi16(
+                    _mm_packs_epi32(s, s), _mm_setzero_si128()
+                ), _mm_set1_epi8(127));
+                const int32_t bytes = _mm_cvtsi128_si32(c);
+                __builtin_memcpy(out + o, &bytes, 4);
+            }
+#else
+            for (int o = 0; o < m; ++o) {
+                const int32_t s = (biases[o] +
+                    dot(in, weights + (size_t) o * n, n)) >> WeightShift;
+                out[o] = s < 0 ? 0 : s > 127 ? 127 : s;
+            }
+#endif
+        }
+    }
+
+    size_t layout(size_t offsets[8]) {
+        const size_t sizes[8] = {
+            L1 * sizeof(int16_t),
+            (size_t) Inputs * L1 * sizeof(int16_t),
+            L2 * sizeof(int32_t),
+            L2 * 2 * L1,
+            L3 * sizeof(int32_t),
+            L3 * L2,
+            sizeof(int32_t),
+            L3
+        };
+        size_t at = sizeof(Header);
+        for (int i = 0; i < 8; ++i) {
+            offsets[i] = at;
+            at += (sizes[i] + 63) & ~(size_t) 63;
+        }
+        return at;
+    }
+
+    bool load(const char* const path) {
+        size_t offsets[8];
+        const size_t size = layout(offsets);
+#ifdef WIN32
+        FILE* const f = fopen(path, "rb");
+        if (!f) return false;
+        void* const base = ::operator new(size, std::align_val_t(64));
+        const bool ok = fread(base, 1, size, f) == size && fgetc(f) == EOF;
+        fclose(f);
+        if (!ok) {
+            release(base, size);
+            return false;
+        }
+#else
+        const int fd = open(path, O_RDONLY);
+        if (fd < 0) return false;
+        struct stat st{};
+        if (fstat(fd, &st) != 0 || (size_t) st.st_size != size) {
+            close(fd);
+            return false;
+        }
+        void* const base = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (base == MAP_FAILED) return false;
+#endif
+        const auto* const h = (const Header*) base;
+        if (h->magic != Magic || h->version != Version ||
+            h->inputs != Inputs || h->l1 != L1 ||
+            h->l2 != L2 || h->l3 != L3) {
+            release(base, size);
+            return false;
+        }
+        // The old network stays until the new one is known to
+        // be good.
+        unload();
+        mapping     = base;
+        mappingSize = size;
+        const auto* const b = (const uint8_t*) base;
+        net.featureBiases  = (const int16_t*) (b + offsets[0]);
+        net.featureWeights = (const int16_t*) (b + offsets[1]);
+        net.hidden1Biases  = (const int32_t*) (b + offsets[2]);
+        net.hidden1Weights = (const int8_t*)  (b + offsets[3]);
+        net.hidden2Biases  = (const int32_t*) (b + offsets[4]);
+        net.hidden2Weights = (const int8_t*)  (b + offsets[5]);
+        net.outputBias     = (const int32_t*) (b + offsets[6]);
+        net.outputWeights  = (const int8_t*)  (b + offsets[7]);
+        return true;
+    }
+
+    void unload() {
+        if (!mapping) return;
+        release(mapping, mappingSize);
+        mapping     = nullptr;
+        mappingSize = 0;
+    }
+
+    bool isLoaded()
+    { return mapping != nullptr; }
+
+    void AccumulatorStack::refresh(const Board& board, Accumulator& acc,
+                                   const int p) {
+        const int king = kingSquare(board, p);
+        const uint64_t black = board.getPieces<Black>();
+        const int16_t* adds[32];
+        int na = 0;
+        for (uint64_t x = board.getAllPieces(); x; x &= x - 1) {
+            const int sq = bitScanFwd(x);
+            const int pt = board.getPiece(sq);
+            if (pt == King) continue;
+            const int a = (int) (black >> (unsigned) sq & 1U);
+            adds[na++] = row(feature(p, king, a * 6 + pt, sq));
+        }
+        addSub(acc.values[p], net.featureBiases, adds, na, nullptr, 0);
+        acc.computed[p] = true;
+    }
+
+    void AccumulatorStack::update(const Board& board, const int ply,
+                                  const int p) {
+        Accumulator& acc = stack[ply];
+        if (acc.computed[p]) return;
+        // Walk down to the nearest computed Accumulator. If
+        // this perspective's king moved on the way, or the
+        // changes pile up, start over instead.
+        const int ownKing = p * 6 + King;
+        int base = ply, changes = 0;
+        for (; base > 0 && !stack[base].computed[p]; --base) {
+            const Delta& d = board.getDelta(ply - base);
+            changes += d.count;
+            for (int i = 0; i < d.count; ++i)
+                if (d.piece[i] == ownKing) changes = MaxChanges + 1;
+            if (changes > MaxChanges) break;
+        }
+        if (!stack[base].computed[p]) {
+            refresh(board, acc, p);
+            return;
+        }
+        const int king = kingSquare(board, p);
+        const int16_t* adds[MaxChanges];
+        const int16_t* subs[MaxChanges];
+        int na = 0, ns = 0;
+        for (int k = base + 1; k <= ply; ++k) {
+            const Delta& d = board.getDelta(ply - k);
+            for (int i = 0; i < d.count; ++i) {
+                // The enemy king is not a feature.
+                if (d.piece[i] % 6 == King) continue;
+                if (d.from[i] != NullSQ)
+                    subs[ns++] = row(feature(p, king, d.piece[i], d.from[i]));
+                if (d.to[i] != NullSQ)
+                    adds[na++] = row(feature(p, king, d.piece[i], d.to[i]));
+            }
+        }
+        addSub(acc.values[p], stack[base].values[p], adds, na, subs, ns);
+        acc.computed[p] = true;
+    }
+
+    void AccumulatorStack::reset(const Board& root) {
+        refresh(root, stack[0], White);
+        refresh(root, stack[0], Black);
+    }
+
+    int AccumulatorStack::evaluate(const Board& board, const int ply) {
+        update(board, ply, White);
+        update(board, ply, Black);
+        const int us = board.currentPlayer();
+        alignas(64) uint8_t input[2 * L1];
+        alignas(64) uint8_t hidden1[L2];
+        alignas(64) uint8_t hidden2[L3];
+        // The player to move's half always comes first.
+        clip(stack[ply].values[us],     input);
+        clip(stack[ply].values[us ^ 1], input + L1);
+        dense(input, 2 * L1, net.hidden1Weights, net.hidden1Biases,
+              hidden1, L2);
+        dense(hidden1, L2, net.hidden2Weights, net.hidden2Biases,
+              hidden2, L3);
+        return (*net.outputBias + dot(hidden2, net.outputWeights, L3)) /
+               OutputScale;
+    }
+}
@@ -0,0 +1,236 @@
+//
+// Created by agent on 10/19/2026.
+//
+
+#pragma once
+#ifndef CHARON_NNUE_H
+#define CHARON_NNUE_H
+
+#include <cstdint>
+#include <cstddef>
+#include "ChaosMagic.h"
+#include "Board.h"
+
+namespace Charon::Nnue {
+
+    /** The number of king squares a perspective can have. */
+    constexpr int KingSquares = 64;
+
+    /**
+     * The number of (piece, square) features per king square:
+     * five non-king piece types of two alliances on 64
+     * squares.
+     */
+    constexpr int PieceSquares = 10 * BoardLength;
+
+    /** The number of HalfKP input features per perspective. */
+    constexpr int Inputs = KingSquares * PieceSquares;
+
+    /** The width of each perspective's accumulator. */
+    constexpr int L1 = 256;
+
+    /** The widths of the two hidden dense layers. */
+    constexpr int L2 = 32;
+    constexpr int L3 = 32;
+
+    /**
+     * The right shift that scales a dense layer's sums back
+     * into the range of its clipped activations.
+     */
+    constexpr int WeightShift = 6;
+
+    /**
+     * The capacity of an AccumulatorStack, in plies: deeper
+     * than any search.
+     */
+    constexpr int StackDepth = 256;
+
+    /** The divisor that turns the output into centipawns. */
+    constexpr int OutputScale = 16;
+
+    /** The magic number at the start of a network file. */
+    constexpr uint32_t Magic = 0x4E4E4843U; // "CHNN"
+
+    /** The version of the network file format. */
+    constexpr uint32_t Version = 1;
+
+    /**
+     * <summary>
+     *  <p>
+     * A struct to hold the 64-byte header of a network file.
+     * The parameters follow, each array starting on a 64-byte
+     * boundary and stored little-endian, in this order:
+     *  </p>
+     *  <ul>
+     *   <li>feature biases: int16[L1]</li>
+     *   <li>feature weights: int16[Inputs][L1]</li>
+     *   <li>hidden 1 biases: int32[L2]</li>
+     *   <li>hidden 1 weights: int8[L2][2 * L1]</li>
+     *   <li>hidden 2 biases: int32[L3]</li>
+     *   <li>hidden 2 weights: int8[L3][L2]</li>
+     *   <li>output bias: int32</li>
+     *   <li>output weights: int8[L3]</li>
+     *  </ul>
+     * </summary>
+     *
+     * @struct Header
+     */
+    struct Header final {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t inputs;
+        uint32_t l1;
+        uint32_t l2;
+        uint32_t l3;
+        uint32_t reserved[10];
+    };
+
+    /**
+     * <summary>
+     * A struct to hold pointers to the parameters of a
+     * network, which live in the mapped file.
+     * </summary>
+     *
+     * @struct Network
+     */
+    struct Network final {
+        const int16_t* featureBiases;
+        const int16_t* featureWeights;
+        const int32_t* hidden1Biases;
+        const int8_t*  hidden1Weights;
+        const int32_t* hidden2Biases;
+        const int8_t*  hidden2Weights;
+        const int32_t* outputBias;
+        const int8_t*  outputWeights;
+    };
+
+    /**
+     * A function to compute the byte offset of each parameter
+     * array in a network file, and the size of the file.
+     *
+     * @param offsets the eight offsets to fill, in file order
+     * @return the size of a network file in bytes
+     */
+    size_t layout(size_t offsets[8]);
+
+    /**
+     * A function to map a network file and make it the
+     * network used by every search. Not safe to call while a
+     * search is running.
+     *
+     * @param path the path of the file
+     * @return whether or not a valid network was loaded
+     */
+    bool load(const char* path);
+
+    /**
+     * A function to unmap the network, if there is one.
+     */
+    void unload();
+
+    /**
+     * A function to determine whether a network is loaded.
+     *
+     * @return whether or not a network is loaded
+     */
+    bool isLoaded();
+
+    /**
+     * <summary>
+     * A struct to hold the feature transformer output of one
+     * position: one accumulator per perspective, and whether
+     * each is up to date.
+     * </summary>
+     *
+     * @struct Accumulator
+     */
+    struct alignas(64) Accumulator final {
+        int16_t values[2][L1];
+        bool    computed[2];
+    };
+
+    /**
+     * <summary>
+     *  <p>
+     * An AccumulatorStack holds one Accumulator per ply of a
+     * search, mirroring the State stack of the searched Board:
+     * the Accumulator at ply p belongs to the State p plies
+     * above the root.
+     *  </p>
+     *  <p>
+     * Playing a move only marks the next Accumulator stale.
+     * It is brought up to date when the position is evaluated,
+     * from the nearest computed Accumulator below it and the
+     * piece Deltas that Board::applyMove recorded in the
+     * States in between. A perspective whose king moved is
+     * refreshed from the Board instead, since every one of
+     * its features changes with the king square.
+     *  </p>
+     * </summary>
+     *
+     * @class AccumulatorStack
+     * @author agent
+     * @version 10.19.2026
+     */
+    class AccumulatorStack final {
+    private:
+
+        /**
+         * @private
+         * The Accumulators, one per ply.
+         */
+        Accumulator stack[StackDepth];
+
+        /**
+         * @private
+         * A method to compute one perspective of an
+         * Accumulator from scratch.
+         *
+         * @param board the board at the Accumulator's ply
+         * @param acc   the Accumulator
+         * @param p     the perspective
+         */
+        static void refresh(const Board& board, Accumulator& acc, int p);
+
+        /**
+         * @private
+         * A method to bring one perspective of the Accumulator
+         * at a ply up to date.
+         *
+         * @param board the board at that ply
+         * @param ply   the ply
+         * @param p     the perspective
+         */
+        void update(const Board& board, int ply, int p);
+    public:
+
+        /**
+         * A method to compute the root Accumulator.
+         *
+         * @param root the board at the root
+         */
+        void reset(const Board& root);
+
+        /**
+         * A method to mark the Accumulator of a ply stale,
+         * after a move or null move is played to reach it.
+         *
+         * @param ply the ply reached
+         */
+        inline void push(const int ply)
+        { stack[ply].computed[White] = stack[ply].computed[Black] = false; }
+
+        /**
+         * A method to evaluate a position with the loaded
+         * network.
+         *
+         * @param board the board at the given ply
+         * @param ply   the distance from the root
+         * @return the score of the position, from the point
+         * of view of the player to move
+         */
+        int evaluate(const Board& board, int ply);
+    };
+}
+
+#endif //CHARON_NNUE_H
@@ -0,0 +1,246 @@
+//
+// Created by agent on 10/19/2026.
+//
+
+#include "Notation.h"
+#include <array>
+#include <cstring>
+#include "MoveMake.h"
+
+namespace Charon::Notation {
+    namespace {
+
+        /** The file and rank characters of each square. */
+        constexpr auto SquareNames = [] {
+            std::array<std::array<char, 2>, BoardLength> n{};
+            for (int sq = 0; sq < BoardLength; ++sq) {
+                n[sq][0] = (char) ('h' - fileOf(sq));
+                n[sq][1] = (char) ('1' + rankOf(sq));
+            }
+            return n;
+        }();
+
+        /** The SAN letter of each piece type. */
+        constexpr const char* PieceLetters = "PRNBQK";
+
+        /** The UCI letter of each promotion piece. */
+        constexpr const char* PromotionLetters = "prnbqk";
+
+        constexpr bool isFile(const char c)
+        { return c >= 'a' && c <= 'h'; }
+
+        constexpr bool isRank(const char c)
+        { return c >= '1' && c <= '8'; }
+
+        /**
+         * A function to read a square, such as e4.
+         *
+         * @param t the text of the square
+         * @return the square, or -1 if the text is not one
+         */
+        constexpr int squareOf(const char* const t) {
+            return isFile(t[0]) && isRank(t[1]) ?
+                (t[1] - '1') * 8 + ('h' - t[0]) : -1;
+        }
+
+        /**
+         * A function to find the piece type of a letter.
+         *
+         * @param c       the letter
+         * @param letters the letters of the piece types
+         * @return the piece type, or NullPT if there is none
+         */
+        constexpr PieceType pieceOf(const char c, const char* const letters) {
+            for (int pt = Pawn; pt < NullPT; ++pt)
+                if (letters[pt] == c) return (PieceType) pt;
+            return NullPT;
+        }
+
+        /**
+         * A function to write a square, such as e4.
+         *
+         * @param p  the position to write to
+         * @param sq the square
+         * @return the position after the square
+         */
+        inline char* writeSquare(char* const p, const int sq) {
+            p[0] = SquareNames[sq][0];
+            p[1] = SquareNames[sq][1];
+            return p + 2;
+        }
+
+        /**
+         * Functions to test the move type. A promotion keeps
+         * its piece where other moves keep their type, so its
+         * type is meaningless.
+         */
+        constexpr bool isCastling(const Move& m)
+        { return !m.isPromotion() && m.moveType() == Castling; }
+
+        constexpr bool isEnPassant(const Move& m)
+        { return !m.isPromotion() && m.moveType() == EnPassant; }
+    }
+
+    char* toUci(const Move& m, char* const buffer) {
+        if (m == NullMove) {
+            memcpy(buffer, "0000", 5);
+            return buffer;
+        }
+        char* p = writeSquare(buffer, m.origin());
+        p = writeSquare(p, m.destination());
+        if (m.isPromotion()) *p++ = PromotionLetters[m.promotionPiece()];
+        *p = '\0';
+        return buffer;
+    }
+
+    Move fromUci(Board& board, const char* const text) {
+        const int from = squareOf(text),
+                  to   = from < 0 ? -1 : squareOf(text + 2);
+        if (to < 0) return NullMove;
+        const char* end = text + 4;
+        PieceType promotion = NullPT;
+        if (*end >= 'a' && *end <= 'z') {
+            promotion = pieceOf(*end++, PromotionLetters);
+            if (promotion <= Pawn || promotion >= King) return NullMove;
+        }
+        // The text may go on past the move, as in a list.
+        if (*end && *end != ' ' && *end != '\n' && *end != '\r')
+            return NullMove;
+        Move moves[256];
+        const int n = MoveFactory::generateMoves<All>(&board, moves);
+        for (int i = 0; i < n; ++i) {
+            const Move m = moves[i];
+            if (m.origin() == from && m.destination() == to &&
+                (m.isPromotion() ? m.promotionPiece() == promotion :
+                 promotion == NullPT))
+                return m;
+        }
+        return NullMove;
+    }
+
+    char* toSan(Board& board, const Move& m, char* const buffer) {
+        const int o = m.origin(), d = m.destination();
+        char* p = buffer;
+        if (isCastling(m)) {
+            const bool kingSide = fileOf(d) == fileOf(G1);
+            memcpy(p, "O-O-O", kingSide ? 3 : 5);
+            p += kingSide ? 3 : 5;
+        } else {
+            const PieceType pt = board.getPiece(o);
+            const bool capture =
+                board.getPiece(d) != NullPT || isEnPassant(m);
+            if (pt == Pawn) {
+                if (capture) {
+                    *p++ = SquareNames[o][0];
+                    *p++ = 'x';
+                }
+                p = writeSquare(p, d);
+                if (m.isPromotion()) {
+                    *p++ = '=';
+                    *p++ = PieceLetters[m.promotionPiece()];
+                }
+            } else {
+                *p++ = PieceLetters[pt];
+                // A king is never ambiguous, so only other
+                // pieces need the list of legal moves.
+                if (pt != King) {
+                    Move moves[256];
+                    const int n =
+                        MoveFactory::generateMoves<All>(&board, moves);
+                    bool shared = false, file = false, rank = false;
+                    for (int i = 0; i < n; ++i) {
+                        const int x = moves[i].origin();
+                        if (x == o || moves[i].destination() != d ||
+                            board.getPiece(x) != pt)
+                            continue;
+                        shared = true;
+                        file |= fileOf(x) == fileOf(o);
+                        rank |= rankOf(x) == rankOf(o);
+                    }
+                    if (shared) {
+                        if (!file) *p++ = SquareNames[o][0];
+                        else if (!rank) *p++ = SquareNames[o][1];
+                        else p = writeSquare(p, o);
+                    }
+                }
+                if (capture) *p++ = 'x';
+                p = writeSquare(p, d);
+            }
+        }
+        // Only a check can be mate, so only a check needs the
+        // replies.
+        if (board.givesCheck(m)) {
+            Move replies[256];
+            board.applyMove(m);
+            *p++ = MoveFactory::generateMoves<All>(&board, replies) ?
+                   '+' : '#';
+            board.retractMove(m);
+        }
+        *p = '\0';
+        return buffer;
+    }
+
+    Move fromSan(Board& board, const char* const text, size_t length) {
+        for (; length > 0; --length) {
+            const char c = text[length - 1];
+            if (c != '+' && c != '#' && c != '!' && c != '?') break;
+        }
+        if (length < 2) return NullMove;
+        Move moves[256];
+        const int n = MoveFactory::generateMoves<All>(&board, moves);
+        if (text[0] == 'O' || text[0] == '0') {
+            // O-O is three characters long, and O-O-O five.
+            const int file = length == 3 ? fileOf(G1) :
+                             length == 5 ? fileOf(C1) : -1;
+            for (int i = 0; i < n; ++i)
+                if (isCastling(moves[i]) &&
+                    fileOf(moves[i].destination()) == file)
+                    return moves[i];
+            return NullMove;
+        }
+        size_t i = 0;
+        PieceType pt = Pawn;
+        if (text[0] >= 'A' && text[0] <= 'Z') {
+            pt = pieceOf(text[0], PieceLetters);
+            if (pt == Pawn || pt == NullPT) return NullMove;
+            i = 1;
+        }
+        // A promotion ends the move, with or without an '='.
+        PieceType promotion = NullPT;
+        if (pt == Pawn && text[length - 1] >= 'A' && text[length - 1] <= 'Z') {
+            promotion = pieceOf(text[length - 1], PieceLetters);
+            if (promotion <= Pawn || promotion >= King) return NullMove;
+            if (--length > 0 && text[length - 1] == '=') --length;
+        }
+        if (length < i + 2) return NullMove;
+        const int to = squareOf(text + length - 2);
+        if (to < 0) return NullMove;
+        // Whatever stands between the piece and the destination
+        // narrows down the origin.
+        int fromFile = -1, fromRank = -1;
+        for (size_t j = i; j < length - 2; ++j) {
+            const char c = text[j];
+            if (isFile(c)) fromFile = 'h' - c;
+            else if (isRank(c)) fromRank = c - '1';
+            else if (c != 'x') return NullMove;
+        }
+        Move found = NullMove;
+        int matches = 0;
+        for (int j = 0; j < n; ++j) {
+            const Move m = moves[j];
+            const int o = m.origin();
+            if (m.destination() != to || board.getPiece(o) != pt ||
+                isCastling(m))
+                continue;
+            if (m.isPromotion() ? m.promotionPiece() != promotion :
+                promotion != NullPT)
+                continue;
+            if ((fromFile >= 0 && fileOf(o) != fromFile) ||
+                (fromRank >= 0 && rankOf(o) != fromRank))
+                continue;
+            found = m;
+            ++matches;
+        }
+        return matches == 1 ? found : NullMove;
+    }
+}
@@ -0,0 +1,76 @@
+//
+// Created by agent on 10/19/2026.
+//
+
+#pragma once
+#ifndef CHARON_NOTATION_H
+#define CHARON_NOTATION_H
+
+#include <cstddef>
+#include "ChaosMagic.h"
+#include "Board.h"
+#include "Move.h"
+
+namespace Charon::Notation {
+
+    /**
+     * The size of a buffer that holds any move in either
+     * notation, such as a7a8q or exd8=Q#, with its null
+     * character.
+     */
+    constexpr size_t MoveLength = 8;
+
+    /**
+     * A function to write a move in the coordinate notation of
+     * UCI, such as e2e4, e1g1 or a7a8q. The null move is
+     * written 0000.
+     *
+     * @param m      the move
+     * @param buffer a buffer of at least six characters
+     * @return the buffer
+     */
+    char* toUci(const Move& m, char* buffer);
+
+    /**
+     * A function to read a move in the coordinate notation of
+     * UCI. The text may go on past the move after a space or a
+     * line break, as in a list of moves.
+     *
+     * @param board the position the move is played in
+     * @param text  the move, such as e2e4 or a7a8q
+     * @return the legal move, or NullMove if there is none
+     */
+    Move fromUci(Board& board, const char* text);
+
+    /**
+     * A function to write a legal move in Standard Algebraic
+     * Notation, such as Nbd7, exd6, e8=Q+ or O-O#. The origin
+     * is disambiguated by file, then rank, then both, only as
+     * far as the other legal moves require.
+     *
+     * @param board  the position the move is played in, which
+     *               is left as it was
+     * @param m      the move
+     * @param buffer a buffer of at least MoveLength characters
+     * @return the buffer
+     */
+    char* toSan(Board& board, const Move& m, char* buffer);
+
+    /**
+     * A function to read a move in Standard Algebraic
+     * Notation. The text is matched against the legal moves of
+     * the position: by the moving piece, the destination, any
+     * promotion, and any file or rank that disambiguates the
+     * origin. Check and annotation marks are ignored, and
+     * castling may be written with zeros.
+     *
+     * @param board  the position the move is played in
+     * @param text   the move
+     * @param length the length of the move
+     * @return the legal move, or NullMove if there is not
+     * exactly one
+     */
+    Move fromSan(Board& board, const char* text, size_t length);
+}
+
+#endif //CHARON_NOTATION_H
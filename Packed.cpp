@@ -0,0 +1,31 @@
+//
+// Created by agent on 10/19/2026.
+//
+
+#include "Packed.h"
+
+namespace Charon::Packed {
+
+    Writer::Writer(const char* const path, const bool append) :
+    file(fopen(path, append ? "ab" : "wb")),
+    buffer(new Position[Capacity]),
+    count(0),
+    written(0)
+    {  }
+
+    Writer::~Writer() {
+        flush();
+        if (file) fclose(file);
+        delete[] buffer;
+    }
+
+    bool Writer::flush() {
+        // Positions that cannot be written are dropped, so that
+        // a full disk does not fill memory instead.
+        const size_t n = file ? fwrite(buffer, sizeof(Position), count, file) : 0;
+        written += n;
+        const bool ok = n == count;
+        count = 0;
+        return ok;
+    }
+}
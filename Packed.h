@@ -0,0 +1,302 @@
+//
+// Created by agent on 10/19/2026.
+//
+
+#pragma once
+#ifndef CHARON_PACKED_H
+#define CHARON_PACKED_H
+
+#include <cstdint>
+#include <cstddef>
+#include <cstdio>
+#include "ChaosMagic.h"
+#include "Board.h"
+#include "Stream.h"
+
+namespace Charon::Packed {
+
+    /**
+     * The bits of the castling field of a Position, in FEN
+     * order. They do not depend on how Board keeps its rights.
+     */
+    enum CastlingBits : uint8_t {
+        WhiteKingSide  = 1,
+        WhiteQueenSide = 2,
+        BlackKingSide  = 4,
+        BlackQueenSide = 8
+    };
+
+    /**
+     * The bit of the flags field of a Position that is set
+     * when Black is to move.
+     */
+    constexpr uint8_t BlackToMove = 0x10U;
+
+    /**
+     * <summary>
+     *  <p>
+     * A Position is a position packed into 32 bytes, for
+     * datasets of training and test positions:
+     *  </p>
+     *  <ul>
+     *   <li>the occupancy bitboard</li>
+     *   <li>a nibble for each occupied square, from the lowest
+     *   square up, two to a byte with the lower square in the
+     *   low nibble: the alliance in the high bit and the piece
+     *   type below. A legal position has at most 32
+     *   pieces.</li>
+     *   <li>the side to move and the castling rights</li>
+     *   <li>the en passant square of Board, or NullSQ</li>
+     *   <li>the halfmove clock, up to 255, and the fullmove
+     *   number</li>
+     *   <li>two labels that the encoder leaves at zero: the
+     *   result of the game from White's point of view, as
+     *   1, 0 or -1, and a score in centipawns from the point
+     *   of view of the player to move</li>
+     *  </ul>
+     *  <p>
+     * The fields are kept in the byte order of the machine,
+     * so that a mapped file of Positions can be read in
+     * place.
+     *  </p>
+     * </summary>
+     *
+     * @struct Position
+     */
+    struct Position final {
+        uint64_t occupancy;
+        uint8_t  pieces[16];
+        uint8_t  flags;
+        uint8_t  epSquare;
+        uint8_t  halfmoveClock;
+        int8_t   result;
+        uint16_t fullmoveNumber;
+        int16_t  score;
+    };
+
+    static_assert(sizeof(Position) == 32);
+
+    /**
+     * A function to pack a board. The labels are set to zero.
+     *
+     * @param board the board to pack
+     * @param p     the Position to fill
+     */
+    inline void encode(const Board& board, Position& p) {
+        const uint64_t black = board.getPieces<Black>();
+        p.occupancy = board.getAllPieces();
+        int i = 0;
+        for (uint64_t b = p.occupancy; b; b &= b - 1, ++i) {
+            const int sq = bitScanFwd(b);
+            const auto nibble = (uint8_t) (
+                ((black >> (unsigned) sq & 1U) << 3U) | board.getPiece(sq)
+            );
+            if (i & 1) p.pieces[i >> 1] |= (uint8_t) (nibble << 4U);
+            else p.pieces[i >> 1] = nibble;
+        }
+        for (i = (i + 1) >> 1; i < 16; ++i) p.pieces[i] = 0;
+        p.flags = (uint8_t) (
+            (board.currentPlayer() == Black ? BlackToMove : 0) |
+            (board.hasCastlingRights<White, KingSide>()  ? WhiteKingSide  : 0) |
+            (board.hasCastlingRights<White, QueenSide>() ? WhiteQueenSide : 0) |
+            (board.hasCastlingRights<Black, KingSide>()  ? BlackKingSide  : 0) |
+            (board.hasCastlingRights<Black, QueenSide>() ? BlackQueenSide : 0)
+        );
+        p.epSquare       = (uint8_t) board.getEpSquare();
+        p.halfmoveClock  = (uint8_t) std::min(board.getHalfmoveClock(), 255);
+        p.result         = 0;
+        p.fullmoveNumber = (uint16_t) board.getFullmoveNumber();
+        p.score          = 0;
+    }
+
+    /**
+     * A function to unpack a Position into an empty Builder.
+     * The labels are not part of the board, and are left in
+     * the Position.
+     *
+     * @param p the Position to unpack
+     * @param b a new Builder for the board
+     */
+    inline void decode(const Position& p, Board::Builder<Fen>& b) {
+        int i = 0;
+        for (uint64_t o = p.occupancy; o; o &= o - 1, ++i) {
+            const unsigned nibble = (unsigned) p.pieces[i >> 1] >> ((i & 1) << 2U);
+            b.setPiece(Alliance((nibble >> 3U) & 1U),
+                       PieceType(nibble & 7U), bitScanFwd(o));
+        }
+        if (p.flags & BlackToMove) b.setCurrentPlayer<Black>();
+        if (p.flags & WhiteKingSide)
+            b.setCastlingRights<White, KingSide, true>();
+        if (p.flags & WhiteQueenSide)
+            b.setCastlingRights<White, QueenSide, true>();
+        if (p.flags & BlackKingSide)
+            b.setCastlingRights<Black, KingSide, true>();
+        if (p.flags & BlackQueenSide)
+            b.setCastlingRights<Black, QueenSide, true>();
+        b.setEnPassantSquare((Square) p.epSquare)
+         .setHalfmoveClock(p.halfmoveClock)
+         .setFullmoveNumber(p.fullmoveNumber);
+    }
+
+    /**
+     * <summary>
+     * A Writer appends Positions to a file through a buffer
+     * of its own.
+     * </summary>
+     *
+     * @class Writer
+     * @author agent
+     * @version 10.19.2026
+     */
+    class Writer final {
+    private:
+
+        /**
+         * @private
+         * The number of Positions buffered between writes.
+         */
+        static constexpr size_t Capacity = 4096;
+
+        /**
+         * @private
+         * The file, or nullptr if it could not be opened.
+         */
+        FILE* file;
+
+        /**
+         * @private
+         * The buffered Positions.
+         */
+        Position* buffer;
+
+        /**
+         * @private
+         * The number of buffered Positions.
+         */
+        size_t count;
+
+        /**
+         * @private
+         * The number of Positions written.
+         */
+        uint64_t written;
+    public:
+
+        /**
+         * A public constructor for a Writer.
+         *
+         * @param path   the file to write to
+         * @param append whether or not to keep what the file
+         *               already holds
+         */
+        explicit Writer(const char* path, bool append = false);
+
+        /** @public Destructor. Flushes the buffer. */
+        ~Writer();
+
+        /** @public Deleted copy constructor. */
+        Writer(const Writer&) = delete;
+
+        /** @public Deleted move constructor. */
+        Writer(Writer&&) = delete;
+
+        /**
+         * A method to append a Position.
+         *
+         * @param p the Position
+         */
+        inline void write(const Position& p) {
+            buffer[count] = p;
+            if (++count == Capacity) flush();
+        }
+
+        /**
+         * A method to write the buffered Positions.
+         *
+         * @return whether or not every Position so far is
+         * written
+         */
+        bool flush();
+
+        /**
+         * A method to determine whether the file could be
+         * opened.
+         *
+         * @return whether or not the file is writable
+         */
+        [[nodiscard]]
+        constexpr bool isOpen() const
+        { return file != nullptr; }
+
+        /**
+         * A method to expose the number of Positions written
+         * so far, buffered ones included.
+         *
+         * @return the number of Positions
+         */
+        [[nodiscard]]
+        constexpr uint64_t size() const
+        { return written + count; }
+    };
+
+    /**
+     * <summary>
+     * A Reader maps a file of Positions and reads them in
+     * place: a Position is never copied until it is decoded.
+     * A partial Position at the end of the file is ignored.
+     * </summary>
+     *
+     * @class Reader
+     * @author agent
+     * @version 10.19.2026
+     */
+    class Reader final {
+    private:
+
+        /**
+         * @private
+         * The mapped file.
+         */
+        const Stream::MappedFile file;
+    public:
+
+        /**
+         * A public constructor for a Reader.
+         *
+         * @param path the file to read
+         */
+        explicit Reader(const char* const path) : file(path)
+        {  }
+
+        /**
+         * A method to determine whether the file could be
+         * mapped.
+         *
+         * @return whether or not the file is readable
+         */
+        [[nodiscard]]
+        constexpr bool isOpen() const
+        { return file.isOpen(); }
+
+        /**
+         * A method to expose the number of Positions.
+         *
+         * @return the number of whole Positions in the file
+         */
+        [[nodiscard]]
+        constexpr size_t size() const
+        { return file.getSize() / sizeof(Position); }
+
+        /**
+         * A method to expose a Position.
+         *
+         * @param i the index of the Position
+         * @return the Position, in the mapped file
+         */
+        [[nodiscard]]
+        inline const Position& operator[](const size_t i) const
+        { return reinterpret_cast<const Position*>(file.getData())[i]; }
+    };
+}
+
+#endif //CHARON_PACKED_H
@@ -0,0 +1,308 @@
+//
+// Created by agent on 10/19/2026.
+//
+
+#pragma once
+#ifndef CHARON_PAWNTABLE_H
+#define CHARON_PAWNTABLE_H
+
+#include <cstdint>
+#include <cstddef>
+#include "ChaosMagic.h"
+#include "Board.h"
+#include "Eval.h"
+
+namespace Charon {
+
+    namespace PawnStructure {
+
+        /** The penalty of a pawn with a pawn of its own ahead. */
+        constexpr Evaluation::Score Doubled =
+            Evaluation::makeScore(-10, -25);
+
+        /** The penalty of a pawn with no pawns of its own beside. */
+        constexpr Evaluation::Score Isolated =
+            Evaluation::makeScore(-12, -15);
+
+        /**
+         * The penalty of a pawn that cannot advance safely and
+         * can no longer be defended by a pawn.
+         */
+        constexpr Evaluation::Score Backward =
+            Evaluation::makeScore(-8, -12);
+
+        /**
+         * The bonus of a passed pawn, by its rank as seen by
+         * its owner. The piece-square tables already reward
+         * advanced pawns, so these are kept modest.
+         */
+        constexpr int PassedMg[] = { 0, 2, 5, 10, 20, 35, 55, 0 };
+        constexpr int PassedEg[] = { 0, 5, 10, 20, 35, 60, 90, 0 };
+
+        /**
+         * The midgame bonus of a shield pawn in front of a
+         * castled king, one and two ranks ahead of it.
+         */
+        constexpr int ShieldNear = 12;
+        constexpr int ShieldFar  = 6;
+
+        /**
+         * The files a king shelters behind in each of the three
+         * king zones: the king side, the center and the queen
+         * side.
+         */
+        constexpr uint64_t ZoneFiles[] = {
+            Files[0] | Files[1] | Files[2],
+            Files[2] | Files[3] | Files[4] | Files[5],
+            Files[5] | Files[6] | Files[7]
+        };
+
+        /**
+         * A function to find the king zone of a file.
+         *
+         * @param file the file, from zero on the H file
+         * @return the zone, from zero on the king side
+         */
+        constexpr int zoneOf(const int file)
+        { return file < 3 ? 0 : file < 5 ? 1 : 2; }
+
+        /**
+         * A function to fill a bitboard toward the far side of
+         * the board of an alliance.
+         *
+         * @param b the bitboard to fill
+         * @tparam A the alliance whose far side to fill toward
+         * @return every square on or ahead of a set square
+         */
+        template<Alliance A>
+        constexpr uint64_t frontFill(uint64_t b) {
+            if constexpr (A == White) {
+                b |= b << 8U; b |= b << 16U; b |= b << 32U;
+            } else {
+                b |= b >> 8U; b |= b >> 16U; b |= b >> 32U;
+            }
+            return b;
+        }
+    }
+
+    /**
+     * <summary>
+     * A struct to hold one pawn table entry: the pawn
+     * structure score of a pawn formation, and the shield
+     * bonus each king would get in each king zone.
+     * </summary>
+     *
+     * @struct PawnEntry
+     */
+    struct PawnEntry final {
+        uint64_t          key;
+        Evaluation::Score score;
+        int16_t           shield[2][3];
+    };
+
+    /**
+     * <summary>
+     *  <p>
+     * A PawnTable caches the evaluation of pawn formations by
+     * the pawn key of Board, which changes only when a pawn
+     * moves, is captured or promotes. Pawn moves are few, so
+     * almost every position of a search finds its formation
+     * already scored.
+     *  </p>
+     *  <p>
+     * A formation is scored set-wise, a whole alliance at a
+     * time, by shifting and filling pawn bitboards: doubled,
+     * isolated, backward and passed pawns. The king shield
+     * depends on where the king stands, so an entry keeps the
+     * shield of each king zone, and the king picks its own.
+     *  </p>
+     *  <p>
+     * A PawnTable belongs to one thread, and it is not safe
+     * to share.
+     *  </p>
+     * </summary>
+     *
+     * @class PawnTable
+     * @author agent
+     * @version 10.19.2026
+     */
+    class PawnTable final {
+    private:
+
+        /**
+         * @private
+         * The entries. An empty entry has the key of a board
+         * without pawns, and the right score for one: zero.
+         */
+        PawnEntry* table;
+
+        /**
+         * @private
+         * The number of entries minus one.
+         */
+        uint64_t mask;
+
+        /**
+         * @private
+         * The number of lookups.
+         */
+        uint64_t probes;
+
+        /**
+         * @private
+         * The number of lookups that found their formation.
+         */
+        uint64_t hits;
+
+        /**
+         * @private
+         * A method to score the pawns of one alliance.
+         *
+         * @param board the current game board
+         * @param e     the entry to fill with the shields
+         * @tparam A    the alliance to score
+         * @return the pawn structure score of the alliance,
+         * from its own point of view
+         */
+        template<Alliance A>
+        static constexpr Evaluation::Score
+        score(const Board& board, PawnEntry& e) {
+            using namespace PawnStructure;
+            constexpr const Alliance them = ~A;
+            constexpr const Defaults* const x = defaults<A>();
+            constexpr const Defaults* const y = defaults<them>();
+            const uint64_t ours   = board.getPieces<A, Pawn>(),
+                           theirs = board.getPieces<them, Pawn>();
+            const uint64_t ourAttacks =
+                shift<x->upRight>(ours & x->notRightCol) |
+                shift<x->upLeft>(ours & x->notLeftCol);
+            const uint64_t theirAttacks =
+                shift<y->upRight>(theirs & y->notRightCol) |
+                shift<y->upLeft>(theirs & y->notLeftCol);
+            // A pawn with one of ours ahead of it on its file.
+            const uint64_t doubled =
+                ours & frontFill<A>(shift<x->up>(ours));
+            // A pawn with no pawn of ours on a file beside it.
+            const uint64_t files =
+                frontFill<A>(ours) | frontFill<them>(ours);
+            const uint64_t isolated = ours &
+                ~(shift<x->right>(files & x->notRightCol) |
+                  shift<x->left>(files & x->notLeftCol));
+            // A pawn whose stop square is attacked and that no
+            // pawn of ours can come up to defend.
+            const uint64_t backward = ours & ~isolated &
+                shift<y->up>(shift<x->up>(ours) & theirAttacks &
+                             ~frontFill<A>(ourAttacks));
+            // A pawn that no pawn of theirs can stop.
+            const uint64_t front = frontFill<them>(shift<y->up>(theirs));
+            const uint64_t passed = ours & ~doubled &
+                ~(front | shift<x->right>(front & x->notRightCol) |
+                          shift<x->left>(front & x->notLeftCol));
+            Evaluation::Score s =
+                Doubled  * highBitCount(doubled)  +
+                Isolated * highBitCount(isolated) +
+                Backward * highBitCount(backward);
+            for (uint64_t p = passed; p; p &= p - 1) {
+                const int r = rankOf(bitScanFwd(p)),
+                          relative = A == White ? r : 7 - r;
+                s += Evaluation::makeScore(PassedMg[relative],
+                                           PassedEg[relative]);
+            }
+            // Shield pawns stand one and two ranks ahead of a
+            // king on its first rank.
+            const uint64_t near = Ranks[A == White ? 1 : 6],
+                           far  = Ranks[A == White ? 2 : 5];
+            for (int z = 0; z < 3; ++z)
+                e.shield[A][z] = (int16_t) (
+                    ShieldNear * highBitCount(ours & ZoneFiles[z] & near) +
+                    ShieldFar  * highBitCount(ours & ZoneFiles[z] & far));
+            return s;
+        }
+
+        /**
+         * @private
+         * A method to find the shield bonus of a king.
+         *
+         * @param board the current game board
+         * @param e     the entry of the pawn formation
+         * @tparam A    the alliance of the king
+         * @return the shield bonus, or zero if the king has
+         * left its first two ranks
+         */
+        template<Alliance A>
+        static constexpr int shield(const Board& board,
+                                    const PawnEntry& e) {
+            const int ksq = bitScanFwd(board.getPieces<A, King>()),
+                      r   = rankOf(ksq);
+            if ((A == White ? r : 7 - r) > 1) return 0;
+            return e.shield[A][PawnStructure::zoneOf(fileOf(ksq))];
+        }
+    public:
+
+        /**
+         * A public constructor for a PawnTable.
+         *
+         * @param entries the number of entries, a power of two
+         */
+        explicit PawnTable(const size_t entries) :
+        table(new PawnEntry[entries]()),
+        mask(entries - 1),
+        probes(0),
+        hits(0)
+        {  }
+
+        /** @public Destructor. */
+        ~PawnTable() { delete[] table; }
+
+        /** @public Deleted copy constructor. */
+        PawnTable(const PawnTable&) = delete;
+
+        /** @public Deleted move constructor. */
+        PawnTable(PawnTable&&) = delete;
+
+        /**
+         * A method to evaluate the pawn structure of the
+         * current position, from the table if it can.
+         *
+         * @param board the current game board
+         * @return the pawn structure score, tapered by game
+         * phase, from the point of view of the player to move
+         */
+        inline int evaluate(const Board& board) {
+            const uint64_t key = board.getPawnKey();
+            PawnEntry& e = table[key & mask];
+            ++probes;
+            if (e.key == key) ++hits;
+            else {
+                e.key   = key;
+                e.score = score<White>(board, e) - score<Black>(board, e);
+            }
+            const Evaluation::Score s = e.score + Evaluation::makeScore(
+                shield<White>(board, e) - shield<Black>(board, e), 0
+            );
+            const int v = Evaluation::taper(s, board.getPhase());
+            return board.currentPlayer() == White ? v : -v;
+        }
+
+        /**
+         * A method to expose the number of lookups.
+         *
+         * @return the number of lookups
+         */
+        [[nodiscard]]
+        constexpr uint64_t getProbes() const
+        { return probes; }
+
+        /**
+         * A method to expose the number of lookups that found
+         * their formation.
+         *
+         * @return the number of hits
+         */
+        [[nodiscard]]
+        constexpr uint64_t getHits() const
+        { return hits; }
+    };
+}
+
+#endif //CHARON_PAWNTABLE_H
@@ -0,0 +1,211 @@
+//
+// Created by agent on 10/19/2026.
+//
+
+#include "Pgn.h"
+#include <atomic>
+#include <cstring>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include "Fen.h"
+#include "Notation.h"
+#include "Stream.h"
+
+namespace Charon::Pgn {
+    namespace {
+
+        /** The longest FEN tag kept. */
+        constexpr size_t FenLength = 128;
+
+        constexpr bool isSpace(const char c)
+        { return c == ' ' || c == '\n' || c == '\r' || c == '\t'; }
+
+        /**
+         * A function to find the start of the next line.
+         *
+         * @param p the current position
+         * @param e the end of the chunk
+         * @return the position after the next line break
+         */
+        const char* nextLine(const char* const p, const char* const e) {
+            const char* const nl = (const char*) memchr(p, '\n', (size_t) (e - p));
+            return nl ? nl + 1 : e;
+        }
+
+        /**
+         * A function to skip a comment in braces.
+         *
+         * @param p the opening brace
+         * @param e the end of the chunk
+         * @return the position after the closing brace
+         */
+        const char* skipComment(const char* const p, const char* const e) {
+            const char* const c = (const char*) memchr(p, '}', (size_t) (e - p));
+            return c ? c + 1 : e;
+        }
+
+        /**
+         * A function to skip a variation, with any variations
+         * and comments nested in it.
+         *
+         * @param p the opening parenthesis
+         * @param e the end of the chunk
+         * @return the position after the closing parenthesis
+         */
+        const char* skipVariation(const char* p, const char* const e) {
+            for (int depth = 0; p < e;) {
+                const char c = *p;
+                if (c == '{') { p = skipComment(p, e); continue; }
+                ++p;
+                if (c == '(') ++depth;
+                else if (c == ')' && --depth == 0) break;
+            }
+            return p;
+        }
+
+        /**
+         * A function to determine whether a token is a game
+         * termination marker.
+         *
+         * @param t the token
+         * @param n the length of the token
+         * @return whether or not the token ends the game
+         */
+        bool isResult(const char* const t, const size_t n) {
+            const std::string_view s(t, n);
+            return s == "1-0" || s == "0-1" || s == "1/2-1/2" || s == "*";
+        }
+
+        /**
+         * A function to replay the movetext of one game.
+         *
+         * @param p       the start of the movetext
+         * @param e       the end of the chunk
+         * @param fen     the FEN tag of the game, or an empty
+         *                string
+         * @param visitor the callback for each move, or nullptr
+         * @param stats   the totals to add to
+         * @return the position after the game
+         */
+        const char* replayGame(const char* p, const char* const e,
+                               const char* const fen,
+                               const Visitor visitor, Stats& stats) {
+            const bool valid = !*fen || FenUtility::isLegal(fen);
+            Board board = valid && *fen ?
+                FenUtility::parseBoard(fen) :
+                Board::Builder<Default>().build();
+            bool ok = valid;
+            uint64_t plies = 0;
+            while (p < e) {
+                const char c = *p;
+                if (isSpace(c)) { ++p; continue; }
+                // A tag begins the next game.
+                if (c == '[') break;
+                if (c == '{') { p = skipComment(p, e); continue; }
+                if (c == '(') { p = skipVariation(p, e); continue; }
+                if (c == ';' || c == '%') { p = nextLine(p, e); continue; }
+                if (c == ')') { ++p; continue; }
+                // Move numbers: 12. or 12...
+                if (FenUtility::isDigit(c)) {
+                    const char* q = p;
+                    for (; q < e && FenUtility::isDigit(*q); ++q);
+                    if (q < e && *q == '.') {
+                        for (; q < e && *q == '.'; ++q);
+                        p = q;
+                        continue;
+                    }
+                }
+                const char* q = p;
+                for (; q < e && !isSpace(*q) && *q != '{' &&
+                       *q != '(' && *q != ')' && *q != ';'; ++q);
+                const size_t n = (size_t) (q - p);
+                if (isResult(p, n)) { p = q; break; }
+                // NAGs, such as $1, say nothing about the move.
+                if (ok && c != '$') {
+                    const Move m = plies < MaxPly - 1 ?
+                        Notation::fromSan(board, p, n) : NullMove;
+                    if (m == NullMove) ok = false;
+                    else {
+                        if (visitor) visitor(board, m);
+                        board.applyMove(m);
+                        ++plies;
+                    }
+                }
+                p = q;
+            }
+            ++stats.games;
+            stats.plies  += plies;
+            stats.errors += !ok;
+            return p;
+        }
+
+        /**
+         * A function to replay the games of a chunk.
+         *
+         * @param p       the start of the chunk
+         * @param e       the end of the chunk
+         * @param visitor the callback for each move, or nullptr
+         * @param stats   the totals to add to
+         */
+        void replayChunk(const char* p, const char* const e,
+                         const Visitor visitor, Stats& stats) {
+            char fen[FenLength];
+            while (p < e) {
+                // Of the tags, only the FEN tag matters.
+                fen[0] = '\0';
+                for (;;) {
+                    for (; p < e && isSpace(*p); ++p);
+                    if (p >= e || (*p != '[' && *p != '%')) break;
+                    const char* const eol = nextLine(p, e);
+                    if (eol - p > 6 && !memcmp(p, "[FEN \"", 6)) {
+                        size_t n = 0;
+                        for (const char* f = p + 6; f < eol && *f != '"' &&
+                             n < FenLength - 1; ++f)
+                            fen[n++] = *f;
+                        fen[n] = '\0';
+                    }
+                    p = eol;
+                }
+                if (p >= e) break;
+                p = replayGame(p, e, fen, visitor, stats);
+            }
+        }
+    }
+
+    bool replay(const char* const path, const int threads,
+                const Visitor visitor, Stats& stats) {
+        const Stream::MappedFile file(path);
+        if (!file.isOpen()) return false;
+        const std::string_view data(file.getData(), file.getSize());
+        // Cut the file into chunks just before an [Event tag.
+        std::vector<size_t> cuts { 0 };
+        while (data.size() - cuts.back() > ChunkBytes) {
+            const size_t next =
+                data.find("\n[Event ", cuts.back() + ChunkBytes - 1);
+            if (next == std::string_view::npos) break;
+            cuts.push_back(next + 1);
+        }
+        cuts.push_back(data.size());
+
+        const int workers = threads < 1 ? 1 : threads;
+        std::atomic<size_t> next(0);
+        std::vector<Stats> totals((size_t) workers);
+        std::vector<std::thread> pool;
+        for (int w = 0; w < workers; ++w)
+            pool.emplace_back([&, w] {
+                Stats s;
+                for (size_t c; (c = next.fetch_add(1)) + 1 < cuts.size();)
+                    replayChunk(data.data() + cuts[c],
+                                data.data() + cuts[c + 1], visitor, s);
+                totals[w] = s;
+            });
+        for (std::thread& t : pool) t.join();
+        for (const Stats& s : totals) {
+            stats.games  += s.games;
+            stats.plies  += s.plies;
+            stats.errors += s.errors;
+        }
+        return true;
+    }
+}
@@ -0,0 +1,84 @@
+//
+// Created by agent on 10/19/2026.
+//
+
+#pragma once
+#ifndef CHARON_PGN_H
+#define CHARON_PGN_H
+
+#include <cstdint>
+#include <cstddef>
+#include "ChaosMagic.h"
+#include "Board.h"
+#include "Move.h"
+
+namespace Charon::Pgn {
+
+    /**
+     * The number of bytes of a PGN file handed to a worker at
+     * a time. A chunk always ends where a game begins, so it
+     * may run a game longer.
+     */
+    constexpr size_t ChunkBytes = 1U << 20U;
+
+    /**
+     * <summary>
+     * A struct to hold the totals of a replay: the games
+     * seen, the plies played, and the games that could not be
+     * played to the end.
+     * </summary>
+     *
+     * @struct Stats
+     */
+    struct Stats final {
+        uint64_t games  = 0;
+        uint64_t plies  = 0;
+        uint64_t errors = 0;
+    };
+
+    /**
+     * A callback to see each move of a replay, with the
+     * position it is played in. It is called from the worker
+     * threads, so it must be safe to call concurrently.
+     *
+     * @param board the position before the move
+     * @param move  the move
+     */
+    typedef void (*Visitor)(const Board& board, const Move& move);
+
+    /**
+     * <summary>
+     *  <p>
+     * A function to replay every game of a PGN file on a pool
+     * of worker threads.
+     *  </p>
+     *  <p>
+     * The file is mapped and split into chunks of about
+     * ChunkBytes, each cut just before an [Event tag so that
+     * no game straddles two chunks. Each worker takes the
+     * next chunk and replays its games one after another on a
+     * Board of its own, from the standard start position or
+     * from the position of a FEN tag. Comments, variations,
+     * NAGs and move numbers are skipped in place, and each
+     * SAN token is resolved by Notation::fromSan, so a move
+     * costs no allocation.
+     *  </p>
+     *  <p>
+     * A game stops at its result, at the next tag section, at
+     * a move that cannot be resolved, or when the Board's
+     * State stack is full. Only the first two end it
+     * cleanly; the others count in Stats::errors.
+     *  </p>
+     * </summary>
+     *
+     * @param path    the PGN file
+     * @param threads the number of workers
+     * @param visitor the callback for each move, or nullptr
+     * @param stats   the totals to add to
+     * @return whether or not the file could be read
+     */
+    bool replay(const char* path, int threads,
+                Visitor visitor, Stats& stats);
+}
+
+#endif //CHARON_PGN_H
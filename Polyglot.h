@@ -0,0 +1,175 @@
+//
+// Created by agent on 10/19/2026.
+//
+
+#pragma once
+#ifndef CHARON_POLYGLOT_H
+#define CHARON_POLYGLOT_H
+
+#include <cstdint>
+#include <cstddef>
+#include "ChaosMagic.h"
+#include "Board.h"
+#include "Move.h"
+#include "Stream.h"
+
+namespace Charon::Polyglot {
+
+    /**
+     * The number of random keys of the Polyglot scheme: 768
+     * for the pieces, four for the castling rights, eight for
+     * the en passant files and one for the side to move.
+     */
+    constexpr size_t KeyCount = 781;
+
+    /**
+     * <summary>
+     * An Entry is one record of a Polyglot book: a position
+     * key, a move, its weight, and a learning field that
+     * Charon does not use. The book keeps its Entries sorted
+     * by key and in big-endian byte order.
+     * </summary>
+     *
+     * @struct Entry
+     */
+    struct Entry final {
+        uint64_t key;
+        uint16_t move;
+        uint16_t weight;
+        uint32_t learn;
+    };
+
+    static_assert(sizeof(Entry) == 16);
+
+    /**
+     * A function to convert a move in the encoding of a
+     * Polyglot book to a legal move of a board. The book
+     * writes the squares as a file and a row from a1, the
+     * promotion as 1 to 4 for knight to queen, and castling
+     * as the king taking its own rook.
+     *
+     * @param board the position the move is played in
+     * @param move  the move of a book Entry
+     * @return the legal move, or NullMove if there is none
+     */
+    Move toMove(Board& board, uint16_t move);
+
+    /**
+     * A function to hash a board with the Polyglot scheme.
+     * As in the specification, the en passant file counts
+     * only if a pawn of the player to move stands beside the
+     * pawn that was pushed.
+     *
+     * @param board the board
+     * @return the Polyglot key of the board
+     */
+    uint64_t key(const Board& board);
+
+    /**
+     * A function to check the keys against the examples of
+     * the Polyglot specification, from the start position to
+     * castling rights lost and en passant files that do and
+     * do not count.
+     *
+     * @return whether or not every example hashes to its key
+     */
+    bool selfTest();
+
+    /**
+     * <summary>
+     *  <p>
+     * A Book maps a Polyglot opening book and looks positions
+     * up in place. Nothing is read at startup: a lookup hashes
+     * the board with the Polyglot keys and binary searches the
+     * sorted Entries, so it touches a few pages of the file
+     * and takes microseconds even for a large book.
+     *  </p>
+     * </summary>
+     *
+     * @class Book
+     * @author agent
+     * @version 10.19.2026
+     */
+    class Book final {
+    private:
+
+        /**
+         * @private
+         * The mapped book.
+         */
+        const Stream::MappedFile file;
+
+        /**
+         * @private
+         * A method to expose the Entries of the book.
+         *
+         * @return the first Entry, in the mapped file
+         */
+        [[nodiscard]]
+        inline const Entry* entries() const
+        { return reinterpret_cast<const Entry*>(file.getData()); }
+    public:
+
+        /**
+         * The most Entries of one position that a probe
+         * returns.
+         */
+        static constexpr int MaxMoves = 64;
+
+        /**
+         * A public constructor for a Book.
+         *
+         * @param path the book to map
+         */
+        explicit Book(const char* const path) : file(path)
+        {  }
+
+        /** @public Deleted copy constructor. */
+        Book(const Book&) = delete;
+
+        /** @public Deleted move constructor. */
+        Book(Book&&) = delete;
+
+        /**
+         * A method to determine whether the book could be
+         * mapped.
+         *
+         * @return whether or not the book can be probed
+         */
+        [[nodiscard]]
+        constexpr bool isOpen() const
+        { return file.isOpen(); }
+
+        /**
+         * A method to expose the number of Entries.
+         *
+         * @return the number of whole Entries in the book
+         */
+        [[nodiscard]]
+        constexpr size_t size() const
+        { return file.getSize() / sizeof(Entry); }
+
+        /**
+         * A method to find the legal book moves of a board.
+         *
+         * @param board   the position to look up
+         * @param moves   a buffer of MaxMoves moves
+         * @param weights a buffer of MaxMoves weights
+         * @return the number of moves found
+         */
+        int probe(Board& board, Move* moves, int* weights) const;
+
+        /**
+         * A method to choose a book move at random, in
+         * proportion to the weights of the moves.
+         *
+         * @param board the position to look up
+         * @param seed  the state of a xorshift64* generator
+         * @return the move, or NullMove if the position is not
+         * in the book
+         */
+        Move choose(Board& board, uint64_t& seed) const;
+    };
+}
+
+#endif //CHARON_POLYGLOT_H
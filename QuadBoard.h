@@ -0,0 +1,292 @@
+//
+// Created by agent on 10/19/2026.
+//
+
+#pragma once
+#ifndef CHARON_QUADBOARD_H
+#define CHARON_QUADBOARD_H
+
+#include <cstdint>
+#include "ChaosMagic.h"
+#include "Board.h"
+#include "Move.h"
+
+namespace Charon {
+
+    /**
+     * <summary>
+     *  <p>
+     * A QuadBoard is a compact, immutable board made of four
+     * bitboards. Each square holds a four-bit code: the low
+     * three bits (one per bitboard) hold the piece type plus
+     * one, so that zero means empty, and the fourth bitboard
+     * marks the black pieces.
+     *  </p>
+     *  <p>
+     * QuadBoards are copy-made rather than applied and
+     * retracted: a child is built from its parent and a Move
+     * with a handful of branch-free bit moves, and the parent
+     * is never touched. There is no mailbox and no State
+     * chain, so a whole position fits in under a cache line
+     * and a perft stack holds one QuadBoard per ply.
+     *  </p>
+     * </summary>
+     *
+     * @class QuadBoard
+     * @author agent
+     * @version 10.19.2026
+     */
+    class QuadBoard final {
+    private:
+
+        /**
+         * @private
+         * The castling rights that survive a move to or from
+         * each square.
+         */
+        static constexpr uint8_t CastlingMasks[BoardLength] = {
+            0x0D, 0x0F, 0x0F, 0x0C, 0x0F, 0x0F, 0x0F, 0x0E,
+            0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+            0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+            0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+            0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+            0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+            0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+            0x07, 0x0F, 0x0F, 0x03, 0x0F, 0x0F, 0x0F, 0x0B
+        };
+
+        /**
+         * @private
+         * The four code bitboards. Bitboards zero through two
+         * hold the bits of (piece type + 1) and bitboard three
+         * holds the black pieces.
+         */
+        uint64_t quad[4]{};
+
+        /**
+         * @private
+         * The alliance of the current player.
+         */
+        Alliance currentPlayerAlliance;
+
+        /**
+         * @private
+         * The castling rights for this position.
+         */
+        uint8_t castlingRights;
+
+        /**
+         * @private
+         * The square of the pawn that just jumped, if any.
+         */
+        Square epSquare;
+
+        /**
+         * @private
+         * A method to move the code on the origin square to
+         * the destination square, emptying the origin.
+         *
+         * @param o the origin square
+         * @param d the destination square
+         */
+        constexpr void moveCode(const int o, const int d) {
+            const uint64_t od = SquareToBitBoard[o] | SquareToBitBoard[d];
+            for (uint64_t& q : quad)
+                q = (q & ~od) | (((q >> o) & 1U) << d);
+        }
+
+        /**
+         * @private
+         * A method to write the given code to the given
+         * square.
+         *
+         * @param sq   the square
+         * @param code the four-bit code to write
+         */
+        constexpr void putCode(const int sq, const unsigned code) {
+            const uint64_t s = SquareToBitBoard[sq];
+            for (int i = 0; i < 4; ++i)
+                quad[i] = (quad[i] & ~s) |
+                          ((uint64_t) ((code >> i) & 1U) << sq);
+        }
+    public:
+
+        /**
+         * A public constructor to copy the given Board into a
+         * QuadBoard.
+         *
+         * @param board the board to copy
+         */
+        explicit QuadBoard(const Board& board) :
+        currentPlayerAlliance(board.currentPlayer()),
+        castlingRights(
+            board.hasCastlingRights<White, QueenSide>()        |
+            board.hasCastlingRights<White, KingSide>()   << 1U |
+            board.hasCastlingRights<Black, QueenSide>()  << 2U |
+            board.hasCastlingRights<Black, KingSide>()   << 3U
+        ),
+        epSquare((Square) board.getEpSquare()) {
+            for (uint64_t x = board.getAllPieces(); x; x &= x - 1) {
+                const int sq = bitScanFwd(x);
+                putCode(sq, (board.getPiece(sq) + 1U) |
+                    ((board.getPieces<Black>() >> sq & 1U) << 3U));
+            }
+        }
+
+        /**
+         * A public constructor to copy-make the child of the
+         * given QuadBoard.
+         *
+         * @param parent the position before the move
+         * @param m      a legal move in the parent position
+         */
+        constexpr QuadBoard(const QuadBoard& parent, const Move& m) :
+        quad{parent.quad[0], parent.quad[1],
+             parent.quad[2], parent.quad[3]},
+        currentPlayerAlliance(~parent.currentPlayerAlliance),
+        castlingRights(parent.castlingRights),
+        epSquare(NullSQ) {
+            const int o = m.origin(), d = m.destination();
+            castlingRights &= CastlingMasks[o] & CastlingMasks[d];
+            moveCode(o, d);
+            if (m.isPromotion()) {
+                putCode(d, (m.promotionPiece() + 1U) |
+                           (parent.currentPlayerAlliance << 3U));
+                return;
+            }
+            switch (m.moveType()) {
+                case PawnJump:
+                    epSquare = (Square) d;
+                    break;
+                case EnPassant:
+                    putCode(parent.epSquare, 0);
+                    break;
+                case Castling: {
+                    const Defaults* const x =
+                        parent.currentPlayerAlliance == White ?
+                        defaults<White>() : defaults<Black>();
+                    if (x->kingSideMask & SquareToBitBoard[d])
+                        moveCode(x->kingSideRookOrigin,
+                                 x->kingSideRookDestination);
+                    else
+                        moveCode(x->queenSideRookOrigin,
+                                 x->queenSideRookDestination);
+                    break;
+                }
+                default: break;
+            }
+        }
+
+        /** @public Trivial copy constructor. */
+        constexpr QuadBoard(const QuadBoard&) = default;
+
+        /**
+         * A method to expose the current player's alliance.
+         *
+         * @return the current player's alliance
+         */
+        [[nodiscard]]
+        constexpr Alliance currentPlayer() const
+        { return currentPlayerAlliance; }
+
+        /**
+         * A method to decode each piece bitboard.
+         *
+         * @tparam A the alliance of the bitboard
+         * @tparam PT the piece type of the bitboard
+         * @return a piece bitboard
+         */
+        template<Alliance A, PieceType PT>
+        [[nodiscard]]
+        constexpr uint64_t getPieces() const {
+            if constexpr (PT == NullPT) return getPieces<A>();
+            else {
+                constexpr unsigned c = PT + 1U;
+                const uint64_t side = A == White ? ~quad[3] : quad[3];
+                return side &
+                    (c & 1U ? quad[0] : ~quad[0]) &
+                    (c & 2U ? quad[1] : ~quad[1]) &
+                    (c & 4U ? quad[2] : ~quad[2]) ;
+            }
+        }
+
+        /**
+         * A method to decode a half-sandwich bitboard of all
+         * pieces belonging to the given alliance.
+         *
+         * @tparam A the alliance of the bitboard
+         * @return a bitboard of all pieces belonging
+         * to the given alliance
+         */
+        template<Alliance A>
+        [[nodiscard]]
+        constexpr uint64_t getPieces() const
+        { return getAllPieces() & (A == White ? ~quad[3] : quad[3]); }
+
+        /**
+         * A method to decode the occupancy bitboard.
+         *
+         * @return a bitboard of all pieces
+         */
+        [[nodiscard]]
+        constexpr uint64_t getAllPieces() const
+        { return quad[0] | quad[1] | quad[2]; }
+
+        /**
+         * A method to expose the en passant square.
+         *
+         * @return the square of the pawn that just jumped
+         */
+        [[nodiscard]]
+        constexpr int getEpSquare() const
+        { return epSquare; }
+
+        /**
+         * A method to decode the piece type on a square.
+         *
+         * @param square the square
+         * @return the piece type on the given square
+         */
+        [[nodiscard]]
+        constexpr PieceType getPiece(const int square) const {
+            const unsigned c = (quad[0] >> square & 1U)       |
+                               (quad[1] >> square & 1U) << 1U |
+                               (quad[2] >> square & 1U) << 2U ;
+            return (PieceType) ((c + 6U) % 7U);
+        }
+
+        /**
+         * A method to expose the castling rights.
+         *
+         * @tparam A the alliance
+         * @tparam CT the castle type
+         * @return the castling rights of the given type and
+         * alliance
+         */
+        template <Alliance A, CastleType CT>
+        [[nodiscard]]
+        constexpr bool hasCastlingRights() const {
+            static_assert(A == White || A == Black);
+            static_assert(CT == KingSide || CT == QueenSide);
+            return castlingRights >>
+                ((A == White ? 0U : 2U) + (CT == KingSide ? 1U : 0U)) & 1U;
+        }
+
+        /**
+         * A method to determine whether any castling rights
+         * remain for the given alliance.
+         *
+         * @tparam A the alliance
+         * @return whether or not the given alliance may
+         * castle to either side
+         */
+        template <Alliance A>
+        [[nodiscard]]
+        constexpr bool hasCastlingRights() const
+        { return castlingRights & (A == White ? 0x03U : 0x0CU); }
+    };
+
+    static_assert(sizeof(QuadBoard) <= 40);
+}
+
+#endif //CHARON_QUADBOARD_H
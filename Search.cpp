@@ -0,0 +1,518 @@
+//
+// Created by agent on 10/19/2026.
+//
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdlib>
+#include <thread>
+#include <utility>
+#include "Search.h"
+#include "MoveMake.h"
+
+namespace Charon::Search {
+    namespace {
+
+        /**
+         * A function to convert a mate score from "mate in n
+         * plies from the root" to "mate in n plies from this
+         * node", for storage in the transposition table.
+         *
+         * @param score the score
+         * @param ply   the distance from the root
+         * @return the score relative to the node
+         */
+        constexpr int toTT(const int score, const int ply) {
+            return score >  MateBound ? score + ply :
+                   score < -MateBound ? score - ply : score;
+        }
+
+        /**
+         * A function to convert a mate score read from the
+         * transposition table back to the root's frame.
+         *
+         * @param score the stored score
+         * @param ply   the distance from the root
+         * @return the score relative to the root
+         */
+        constexpr int fromTT(const int score, const int ply) {
+            return score >  MateBound ? score - ply :
+                   score < -MateBound ? score + ply : score;
+        }
+
+        /**
+         * The iteration pattern of each Lazy SMP helper: a
+         * helper searches in runs of SkipSize depths and
+         * skips every other run, starting SkipPhase depths
+         * in. The twenty patterns repeat for more helpers.
+         */
+        constexpr int SkipSize[]  =
+        { 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4 };
+        constexpr int SkipPhase[] =
+        { 0, 1, 0, 1, 2, 3, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 6, 7 };
+
+        /**
+         * A function to decide whether a helper should skip
+         * an iteration.
+         *
+         * @param id    the index of the helper, from one
+         * @param depth the depth of the iteration
+         * @return whether or not to skip the iteration
+         */
+        constexpr bool skip(const int id, const int depth) {
+            const int i = (id - 1) % 20;
+            return ((depth + SkipPhase[i]) / SkipSize[i]) % 2;
+        }
+
+        /**
+         * A margin for delta pruning: no positional swing in
+         * a capture is worth more than this.
+         */
+        constexpr int DeltaMargin = 200;
+
+        /**
+         * A function to score a capture by most valuable
+         * victim, least valuable attacker.
+         *
+         * @param board the current game board
+         * @param m     the capture
+         * @return the MVV-LVA score of the capture
+         */
+        inline int mvvLva(const Board& board, const Move& m) {
+            const PieceType victim = board.getPiece(m.destination());
+            // En passant lands on an empty square.
+            const int v = victim == NullPT ? SeeValues[Pawn] : SeeValues[victim];
+            return v * 8 - SeeValues[board.getPiece(m.origin())] / 100 +
+                   (m.isPromotion() ? SeeValues[m.promotionPiece()] : 0);
+        }
+
+        /**
+         * A function to select the best-scored move of the
+         * unsearched part of a move list and swap it into
+         * place.
+         *
+         * @param moves  the move list
+         * @param scores the score of each move
+         * @param i      the index of the next move to search
+         * @param n      the number of moves
+         */
+        inline void pickNext(Move* const moves, int* const scores,
+                             const int i, const int n) {
+            int best = i;
+            for (int j = i + 1; j < n; ++j)
+                if (scores[j] > scores[best]) best = j;
+            std::swap(moves[i], moves[best]);
+            std::swap(scores[i], scores[best]);
+        }
+
+        /**
+         * A function to determine whether a move captures.
+         *
+         * @param board the current game board
+         * @param m     the move
+         * @return whether or not the move captures a piece
+         */
+        inline bool isCapture(const Board& board, const Move& m) {
+            return board.getPiece(m.destination()) != NullPT ||
+                  (!m.isPromotion() && m.moveType() == EnPassant);
+        }
+
+        /**
+         * The ordering score of each kind of move. Quiet
+         * moves score their history, which lies strictly
+         * between LosingCapture and CounterMoveScore.
+         */
+        constexpr int TTMoveScore      = 1 << 30;
+        constexpr int WinningCapture   = 1 << 28;
+        constexpr int KillerScore      = 1 << 26;
+        constexpr int CounterMoveScore = 1 << 25;
+        constexpr int LosingCapture    = -(1 << 28);
+
+        /**
+         * Reverse futility pruning: within this depth, a node
+         * whose static evaluation beats beta by RfpMargin per
+         * ply of depth is assumed to fail high.
+         */
+        constexpr int RfpDepth  = 6;
+        constexpr int RfpMargin = 80;
+
+        /**
+         * Futility pruning: within this depth, quiet moves are
+         * skipped at a node whose static evaluation falls
+         * short of alpha by more than FutilityMargin per ply
+         * of depth, plus FutilityBase.
+         */
+        constexpr int FutilityDepth  = 3;
+        constexpr int FutilityBase   = 100;
+        constexpr int FutilityMargin = 100;
+
+        /**
+         * Null-move pruning: the least depth to try a null
+         * move at, and the depth it gives up, before adding
+         * one ply for every NullMoveDivisor plies of depth.
+         */
+        constexpr int NullMoveDepth     = 3;
+        constexpr int NullMoveReduction = 3;
+        constexpr int NullMoveDivisor   = 6;
+
+        /**
+         * Late move reductions: the least depth to reduce at,
+         * and the number of moves searched in full first.
+         */
+        constexpr int LmrDepth = 3;
+        constexpr int LmrMoves = 2;
+
+        /**
+         * The base reduction of a late quiet move, by depth
+         * and by its index in the move list. It grows with
+         * the logarithm of each.
+         */
+        const auto Reductions = [] {
+            std::array<std::array<int8_t, 64>, 64> r{};
+            for (int d = 1; d < 64; ++d)
+                for (int i = 1; i < 64; ++i)
+                    r[d][i] = (int8_t) (0.75 + std::log(d) * std::log(i) / 2.25);
+            return r;
+        }();
+
+        /**
+         * A function to determine whether the player to move
+         * has a piece other than pawns and the king. Without
+         * one, zugzwang is likely, and passing is no proof of
+         * a strong position.
+         *
+         * @param board the current game board
+         * @return whether or not the player to move has a
+         * piece
+         */
+        inline bool hasPieces(const Board& board) {
+            return board.currentPlayer() == White ?
+                board.getPieces<White>() ^ board.getPieces<White, Pawn>() ^
+                board.getPieces<White, King>() :
+                board.getPieces<Black>() ^ board.getPieces<Black, Pawn>() ^
+                board.getPieces<Black, King>();
+        }
+    }
+
+    Searcher::Searcher(const Board& root, TranspositionTable& tt,
+                       std::atomic<bool>& stop, const int id) :
+    board(root), tt(tt), id(id), stopped(stop), nodes(0),
+    pvLength{}, played{}, killers{},
+    history{}, counterMoves{}, failHighs(0), failHighFirsts(0),
+    heuristics(AllHeuristics), useNnue(false), pawns(PawnTableSize)
+    {  }
+
+    void Searcher::scoreMoves(const Move* const moves, int* const scores,
+                              const int n, const Move& ttMove,
+                              const int ply) const {
+        const Move counter = ply > 0 ?
+            counterMoves[played[ply - 1].fromTo()] : NullMove;
+        const int* const h = history[board.currentPlayer()];
+        for (int i = 0; i < n; ++i) {
+            const Move& m = moves[i];
+            if (m == ttMove)
+                scores[i] = TTMoveScore;
+            else if (m.isPromotion() || isCapture(board, m))
+                scores[i] = mvvLva(board, m) +
+                    (m.isPromotion() || board.seeGE(m, 0) ?
+                     WinningCapture : LosingCapture);
+            else if (m == killers[ply][0])
+                scores[i] = KillerScore + 1;
+            else if (m == killers[ply][1])
+                scores[i] = KillerScore;
+            else if (m == counter)
+                scores[i] = CounterMoveScore;
+            else
+                scores[i] = h[m.fromTo()];
+        }
+    }
+
+    void Searcher::reward(const Move& m, const Move* const quiets,
+                          const int n, const int depth, const int ply) {
+        if (killers[ply][0] != m) {
+            killers[ply][1] = killers[ply][0];
+            killers[ply][0] = m;
+        }
+        if (ply > 0) counterMoves[played[ply - 1].fromTo()] = m;
+        // Each update pulls a score toward the bound in its
+        // direction, so scores saturate instead of growing
+        // without limit.
+        int* const h = history[board.currentPlayer()];
+        const int bonus = std::min(depth * depth, 400);
+        const auto update = [h](const Move& q, const int b) {
+            int& e = h[q.fromTo()];
+            e += b - e * std::abs(b) / MaxHistory;
+        };
+        update(m, bonus);
+        for (int i = 0; i < n; ++i) update(quiets[i], -bonus);
+    }
+
+    int Searcher::search(int alpha, const int beta,
+                         int depth, const int ply) {
+        pvLength[ply] = ply;
+        ++nodes;
+        poll();
+        if (stopped.load(std::memory_order_relaxed)) return 0;
+        if (ply > 0 && board.isDraw()) return 0;
+        // A player in check has few replies, so a check is
+        // searched one ply deeper, and its threat is not
+        // pushed past the horizon.
+        const bool inCheck = board.inCheck();
+        if (inCheck && enabled(CheckExtensions)) ++depth;
+        if (depth <= 0 || ply >= MaxDepth) return quiesce(alpha, beta, ply);
+        const bool pvNode = beta - alpha > 1;
+
+        // Probe the transposition table.
+        TTEntry e;
+        Move ttMove = NullMove;
+        if (tt.probe(board.getKey(), e)) {
+            ttMove = Move(e.move);
+            const int s = fromTT(e.score, ply);
+            if (!pvNode && e.depth >= depth &&
+               (e.bound == Exact ||
+               (e.bound == Lower && s >= beta) ||
+               (e.bound == Upper && s <= alpha)))
+                return s;
+        }
+
+        // The static evaluation means nothing in check.
+        const int eval = inCheck ? -Infinity : evaluate(ply);
+        if (!pvNode && !inCheck) {
+            // Reverse futility pruning: far enough above
+            // beta, near the leaves, the opponent is not
+            // going to catch up.
+            if (enabled(ReverseFutility) && depth <= RfpDepth &&
+                eval - RfpMargin * depth >= beta)
+                return eval;
+            // Null-move pruning: if passing still fails high
+            // at a reduced depth, a real move would too. Two
+            // null moves in a row prove nothing.
+            if (enabled(NullMovePruning) && depth >= NullMoveDepth &&
+                eval >= beta && ply > 0 && played[ply - 1] != NullMove &&
+                hasPieces(board)) {
+                const int r = NullMoveReduction + depth / NullMoveDivisor;
+                played[ply] = NullMove;
+                board.applyNullMove();
+                accumulators.push(ply + 1);
+                const int score =
+                    -search(-beta, -beta + 1, depth - 1 - r, ply + 1);
+                board.retractNullMove();
+                if (stopped.load(std::memory_order_relaxed)) return 0;
+                // A mate found by passing is not a real one.
+                if (score >= beta) return score > MateBound ? beta : score;
+            }
+        }
+
+        Move moves[256];
+        const int n = MoveFactory::generateMoves<All>(&board, moves);
+        if (n == 0) return inCheck ? -MateValue + ply : 0;
+        // Helpers break ties between root moves in a
+        // different order each, so that they diverge from
+        // the main Searcher.
+        if (ply == 0 && id > 0 && n > 2)
+            std::rotate(moves, moves + id % n, moves + n);
+        int scores[256];
+        scoreMoves(moves, scores, n, ttMove, ply);
+
+        // Futility pruning: near the leaves, far enough below
+        // alpha, only captures, promotions and checks can
+        // raise the score.
+        const bool futile = enabled(FutilityPruning) && !pvNode &&
+            !inCheck && depth <= FutilityDepth &&
+            eval + FutilityBase + FutilityMargin * depth <= alpha;
+        const CheckInfo ci = futile ? board.checkInfo() : CheckInfo{};
+
+        const int alpha0 = alpha;
+        const int* const h = history[board.currentPlayer()];
+        int best = -Infinity;
+        Move bestMove = NullMove;
+        Move quiets[256];
+        int quietCount = 0;
+        for (int i = 0; i < n; ++i) {
+            pickNext(moves, scores, i, n);
+            const Move& m = moves[i];
+            const bool quiet = !m.isPromotion() && !isCapture(board, m);
+            if (futile && quiet && i > 0 && best > -MateBound &&
+                !board.givesCheck(m, ci))
+                continue;
+            played[ply] = m;
+            board.applyMove(m);
+            accumulators.push(ply + 1);
+            int score;
+            if (i == 0)
+                score = -search(-beta, -alpha, depth - 1, ply + 1);
+            else {
+                // Late move reductions: a quiet move this far
+                // down a well-ordered list is rarely best, so
+                // it is first searched to a lesser depth, less
+                // so if it has a good history.
+                int r = 0;
+                if (enabled(LateMoveReductions) && quiet &&
+                    depth >= LmrDepth && i >= LmrMoves &&
+                    !inCheck && !board.inCheck()) {
+                    r = Reductions[std::min(depth, 63)][std::min(i, 63)] -
+                        pvNode - h[m.fromTo()] / (MaxHistory / 2);
+                    r = std::clamp(r, 0, depth - 2);
+                }
+                // Prove the move is no better with a null
+                // window, and re-search only if it is.
+                score = -search(-alpha - 1, -alpha, depth - 1 - r, ply + 1);
+                if (r > 0 && score > alpha)
+                    score = -search(-alpha - 1, -alpha, depth - 1, ply + 1);
+                if (score > alpha && score < beta)
+                    score = -search(-beta, -alpha, depth - 1, ply + 1);
+            }
+            board.retractMove(m);
+            // A stopped search leaves nothing behind.
+            if (stopped.load(std::memory_order_relaxed)) return 0;
+            if (score > best) {
+                best = score;
+                bestMove = m;
+            }
+            if (score > alpha) {
+                alpha = score;
+                pv[ply][ply] = m;
+                for (int j = ply + 1; j < pvLength[ply + 1]; ++j)
+                    pv[ply][j] = pv[ply + 1][j];
+                pvLength[ply] = pvLength[ply + 1];
+                if (alpha >= beta) {
+                    ++failHighs;
+                    failHighFirsts += i == 0;
+                    if (quiet) reward(m, quiets, quietCount, depth, ply);
+                    break;
+                }
+            }
+            if (quiet) quiets[quietCount++] = m;
+        }
+
+        tt.store(board.getKey(), bestMove, toTT(best, ply), depth,
+                 best >= beta  ? Lower :
+                 best > alpha0 ? Exact : Upper);
+        return best;
+    }
+
+    int Searcher::quiesce(int alpha, const int beta, const int ply) {
+        pvLength[ply] = ply;
+        ++nodes;
+        poll();
+        if (ply >= MaxDepth) return evaluate(ply);
+
+        // In check there is no standing pat: every evasion
+        // is searched. Otherwise, captures only.
+        Move moves[256];
+        const bool inCheck = board.inCheck();
+        int best = -Infinity, standPat = 0, n;
+        if (inCheck) {
+            n = MoveFactory::generateMoves<All>(&board, moves);
+            if (n == 0) return -MateValue + ply;
+        } else {
+            standPat = best = evaluate(ply);
+            if (standPat >= beta) return standPat;
+            if (standPat > alpha) alpha = standPat;
+            n = MoveFactory::generateMoves<Aggressive>(&board, moves);
+        }
+
+        int scores[256];
+        for (int i = 0; i < n; ++i) scores[i] = mvvLva(board, moves[i]);
+        for (int i = 0; i < n; ++i) {
+            pickNext(moves, scores, i, n);
+            const Move& m = moves[i];
+            // Delta pruning: skip captures that cannot lift
+            // the score to alpha even with a positional bonus.
+            if (!inCheck && !m.isPromotion()) {
+                const PieceType victim = board.getPiece(m.destination());
+                if (standPat + DeltaMargin +
+                    SeeValues[victim == NullPT ? Pawn : victim] <= alpha)
+                    continue;
+            }
+            board.applyMove(m);
+            accumulators.push(ply + 1);
+            const int score = -quiesce(-beta, -alpha, ply + 1);
+            board.retractMove(m);
+            if (stopped.load(std::memory_order_relaxed)) return 0;
+            if (score <= best) continue;
+            best = score;
+            if (score <= alpha) continue;
+            alpha = score;
+            pv[ply][ply] = m;
+            for (int j = ply + 1; j < pvLength[ply + 1]; ++j)
+                pv[ply][j] = pv[ply + 1][j];
+            pvLength[ply] = pvLength[ply + 1];
+            if (alpha >= beta) break;
+        }
+        return best;
+    }
+
+    Move Searcher::think(const Limits& limits, const Reporter reporter) {
+        const Alliance a = board.currentPlayer();
+        timer.begin(limits.time[a], limits.inc[a], limits.movesToGo,
+                    limits.moveTime, limits.nodes);
+        heuristics = limits.heuristics;
+        useNnue = Nnue::isLoaded();
+        if (useNnue) accumulators.reset(board);
+        Move best = NullMove;
+        Iteration it{};
+        // Helpers run on until they are stopped.
+        const int last = id > 0 ? MaxDepth - 1 : limits.depth;
+        for (int depth = 1; depth <= last; ++depth) {
+            if (id > 0 && depth > 1 && skip(id, depth)) continue;
+            const uint64_t before = nodes;
+            const int score = search(-Infinity, Infinity, depth, 0);
+            if (stopped.load(std::memory_order_relaxed)) break;
+            it.depth          = depth;
+            it.score          = score;
+            it.nodes          = nodes - before;
+            it.totalNodes     = nodes;
+            it.failHighs      = failHighs;
+            it.failHighFirsts = failHighFirsts;
+            it.pawnProbes     = pawns.getProbes();
+            it.pawnHits       = pawns.getHits();
+            it.seconds        = timer.seconds();
+            it.pvLength       = pvLength[0];
+            for (int j = 0; j < pvLength[0]; ++j) it.pv[j] = pv[0][j];
+            const bool changed = best != NullMove && pvLength[0] > 0 &&
+                                 pv[0][0] != best;
+            if (pvLength[0] > 0) best = pv[0][0];
+            if (reporter) reporter(it);
+            // Stop early once a forced mate is found.
+            if (score > MateBound || score < -MateBound) break;
+            if (id == 0 && timer.finished(changed)) break;
+        }
+        // A search stopped in its first iteration still owes
+        // a move: the best of those searched, else any.
+        if (best == NullMove) {
+            if (pvLength[0] > 0) best = pv[0][0];
+            else {
+                Move moves[256];
+                if (MoveFactory::generateMoves<All>(&board, moves) > 0)
+                    best = moves[0];
+            }
+        }
+        return best;
+    }
+
+    Move think(const Board& root, TranspositionTable& tt,
+               const Limits& limits, const Reporter reporter,
+               std::atomic<bool>& stop) {
+        const int n = std::clamp(limits.threads, 1, MaxThreads);
+        Searcher* helpers[MaxThreads];
+        std::thread threads[MaxThreads];
+        for (int i = 1; i < n; ++i) {
+            Searcher* const h = helpers[i] =
+                new Searcher(root, tt, stop, i);
+            threads[i] = std::thread([h, &limits] {
+                h->think(limits, nullptr);
+            });
+        }
+        Searcher* const main = new Searcher(root, tt, stop);
+        const Move best = main->think(limits, reporter);
+        stop.store(true, std::memory_order_relaxed);
+        for (int i = 1; i < n; ++i) {
+            threads[i].join();
+            delete helpers[i];
+        }
+        delete main;
+        return best;
+    }
+}
@@ -0,0 +1,421 @@
+//
+// Created by agent on 10/19/2026.
+//
+
+#pragma once
+#ifndef CHARON_SEARCH_H
+#define CHARON_SEARCH_H
+
+#include <cstdint>
+#include <atomic>
+#include "ChaosMagic.h"
+#include "Board.h"
+#include "Move.h"
+#include "TranspositionTable.h"
+#include "PawnTable.h"
+#include "TimeManager.h"
+#include "Nnue.h"
+
+namespace Charon::Search {
+
+    /** A score beyond any reachable score. */
+    constexpr int Infinity = 32001;
+
+    /** The score of delivering mate now. */
+    constexpr int MateValue = 32000;
+
+    /** Scores beyond this bound are mates. */
+    constexpr int MateBound = MateValue - 256;
+
+    /** The deepest a search may reach, in plies. */
+    constexpr int MaxDepth = 128;
+    static_assert(MaxDepth < Nnue::StackDepth);
+
+    /** The bound of every butterfly history score. */
+    constexpr int MaxHistory = 16384;
+
+    /** The most threads a search may use. */
+    constexpr int MaxThreads = 256;
+
+    /** The number of entries in each Searcher's PawnTable. */
+    constexpr size_t PawnTableSize = 1U << 16U;
+
+    /**
+     * The selective heuristics of the main search, as bits,
+     * so that each can be turned off on its own and its
+     * effect on the nodes to reach a depth measured.
+     */
+    enum Heuristic : uint8_t {
+        NullMovePruning    = 1U << 0U,
+        LateMoveReductions = 1U << 1U,
+        ReverseFutility    = 1U << 2U,
+        FutilityPruning    = 1U << 3U,
+        CheckExtensions    = 1U << 4U,
+        AllHeuristics      = (1U << 5U) - 1U
+    };
+
+    /**
+     * <summary>
+     * A struct to hold the limits of one search.
+     * </summary>
+     *
+     * @struct Limits
+     */
+    struct Limits final {
+        int      depth      = MaxDepth - 1;
+        int      threads    = 1;
+        int64_t  time[2]    = { 0, 0 };
+        int64_t  inc[2]     = { 0, 0 };
+        int      movesToGo  = 0;
+        int64_t  moveTime   = 0;
+        uint64_t nodes      = 0;
+        uint8_t  heuristics = AllHeuristics;
+    };
+
+    /**
+     * <summary>
+     * A struct to hold the result of one completed iteration
+     * of iterative deepening.
+     * </summary>
+     *
+     * @struct Iteration
+     */
+    struct Iteration final {
+        int      depth;
+        int      score;
+        uint64_t nodes;
+        uint64_t totalNodes;
+        double   seconds;
+        uint64_t failHighs;
+        uint64_t failHighFirsts;
+        uint64_t pawnProbes;
+        uint64_t pawnHits;
+        int      pvLength;
+        Move     pv[MaxDepth];
+    };
+
+    /** A callback to report each completed Iteration. */
+    typedef void (*Reporter)(const Iteration&);
+
+    /**
+     * <summary>
+     *  <p>
+     * A Searcher runs a negamax alpha-beta search with
+     * principal-variation search and a transposition table,
+     * driven by iterative deepening, on its own copy of a
+     * Board.
+     *  </p>
+     *  <p>
+     * Moves come from MoveFactory::generateMoves and are
+     * played with Board::applyMove. Leaves are extended by
+     * a quiescence search over captures, and quiet positions
+     * are scored by the loaded Nnue network, or else with
+     * Board::evaluate and the pawn structure terms of the
+     * Searcher's own PawnTable.
+     *  </p>
+     *  <p>
+     * The tree is shaped by null-move pruning, reverse
+     * futility and futility pruning, late move reductions
+     * and check extensions, each of which the Limits may
+     * turn off.
+     *  </p>
+     *  <p>
+     * Moves are searched best-first: the table move, then
+     * captures that do not lose material by MVV-LVA, then
+     * the killers and the countermove, then the other quiet
+     * moves by butterfly history, and last the losing
+     * captures.
+     *  </p>
+     *  <p>
+     * A Searcher with a nonzero id is a Lazy SMP helper: it
+     * skips some iterations and shuffles its root moves, so
+     * that it fills the shared table with entries the main
+     * Searcher has not yet reached. A helper runs until it is
+     * stopped.
+     *  </p>
+     *  <p>
+     * Every Searcher of a pool watches the same stop flag.
+     * The main Searcher also keeps the limits, with a
+     * TimeManager, and raises the flag when one is spent. A
+     * node limit counts the main Searcher's nodes alone, so
+     * a single-threaded search to a node limit is the same
+     * on every run.
+     *  </p>
+     * </summary>
+     *
+     * @class Searcher
+     * @author agent
+     * @version 10.19.2026
+     */
+    class Searcher final {
+    private:
+
+        /**
+         * @private
+         * The searcher's own copy of the root position.
+         */
+        Board board;
+
+        /**
+         * @private
+         * The shared transposition table.
+         */
+        TranspositionTable& tt;
+
+        /**
+         * @private
+         * The index of this Searcher in its pool. Zero is the
+         * main Searcher.
+         */
+        const int id;
+
+        /**
+         * @private
+         * The stop flag shared by the pool. When it is raised,
+         * the search unwinds as soon as possible.
+         */
+        std::atomic<bool>& stopped;
+
+        /**
+         * @private
+         * The clock and the limits of the search.
+         */
+        TimeManager timer;
+
+        /**
+         * @private
+         * The number of nodes visited.
+         */
+        uint64_t nodes;
+
+        /**
+         * @private
+         * A triangular table of principal variations, one
+         * row per ply.
+         */
+        Move pv[MaxDepth + 1][MaxDepth + 1];
+
+        /**
+         * @private
+         * The length of each principal variation row.
+         */
+        int pvLength[MaxDepth + 1];
+
+        /**
+         * @private
+         * The move played to reach each ply.
+         */
+        Move played[MaxDepth + 1];
+
+        /**
+         * @private
+         * Two quiet moves per ply that last caused a beta
+         * cutoff there.
+         */
+        Move killers[MaxDepth + 1][2];
+
+        /**
+         * @private
+         * A score for each quiet move of each player, by its
+         * 12-bit origin and destination, that rises when the
+         * move causes a beta cutoff and falls when it fails to.
+         */
+        int history[2][1U << 12U];
+
+        /**
+         * @private
+         * The quiet move that last refuted each move, by the
+         * refuted move's origin and destination.
+         */
+        Move counterMoves[1U << 12U];
+
+        /**
+         * @private
+         * The number of beta cutoffs in the main search.
+         */
+        uint64_t failHighs;
+
+        /**
+         * @private
+         * The number of beta cutoffs by the first move tried.
+         */
+        uint64_t failHighFirsts;
+
+        /**
+         * @private
+         * The Heuristics turned on for this search.
+         */
+        uint8_t heuristics;
+
+        /**
+         * @private
+         * Whether or not positions are scored by the network.
+         */
+        bool useNnue;
+
+        /**
+         * @private
+         * The network accumulators, one per ply.
+         */
+        Nnue::AccumulatorStack accumulators;
+
+        /**
+         * @private
+         * The pawn structure cache of this Searcher.
+         */
+        PawnTable pawns;
+
+        /**
+         * @private
+         * A method to search the current position.
+         *
+         * @param alpha the lower bound of the window
+         * @param beta  the upper bound of the window
+         * @param depth the remaining depth
+         * @param ply   the distance from the root
+         * @return the score of the position, from the point
+         * of view of the player to move
+         */
+        int search(int alpha, int beta, int depth, int ply);
+
+        /**
+         * @private
+         * A method to determine whether a heuristic is turned
+         * on.
+         *
+         * @param h the heuristic
+         * @return whether or not the heuristic is turned on
+         */
+        [[nodiscard]]
+        constexpr bool enabled(const Heuristic h) const
+        { return heuristics & h; }
+
+        /**
+         * @private
+         * A method to resolve captures at the leaves of the
+         * main search, so that only quiet positions are
+         * evaluated.
+         *
+         * @param alpha the lower bound of the window
+         * @param beta  the upper bound of the window
+         * @param ply   the distance from the root
+         * @return the score of the position, from the point
+         * of view of the player to move
+         */
+        int quiesce(int alpha, int beta, int ply);
+
+        /**
+         * @private
+         * A method to score the current position statically.
+         *
+         * @param ply the distance from the root
+         * @return the score of the position, from the point
+         * of view of the player to move
+         */
+        inline int evaluate(const int ply) {
+            return useNnue ? accumulators.evaluate(board, ply) :
+                             board.evaluate() + pawns.evaluate(board);
+        }
+
+        /**
+         * @private
+         * A method to score each move of a list for ordering.
+         *
+         * @param moves   the move list
+         * @param scores  the scores to fill, one per move
+         * @param n       the number of moves
+         * @param ttMove  the move from the transposition table,
+         *                or NullMove
+         * @param ply     the distance from the root
+         */
+        void scoreMoves(const Move* moves, int* scores, int n,
+                        const Move& ttMove, int ply) const;
+
+        /**
+         * @private
+         * A method to reward a quiet move that caused a beta
+         * cutoff, and to punish the quiet moves tried before
+         * it.
+         *
+         * @param m      the move that caused the cutoff
+         * @param quiets the quiet moves tried before it
+         * @param n      the number of quiet moves tried
+         * @param depth  the remaining depth
+         * @param ply    the distance from the root
+         */
+        void reward(const Move& m, const Move* quiets, int n,
+                    int depth, int ply);
+
+        /**
+         * @private
+         * A method to stop the search once a hard limit is
+         * spent. Only the main Searcher keeps the limits.
+         */
+        inline void poll() {
+            if (id == 0 && timer.expired(nodes))
+                stopped.store(true, std::memory_order_relaxed);
+        }
+    public:
+
+        /**
+         * A public constructor for a Searcher.
+         *
+         * @param root the position to search
+         * @param tt   the transposition table to share
+         * @param stop the stop flag to share
+         * @param id   the index of the Searcher in its pool
+         */
+        Searcher(const Board& root, TranspositionTable& tt,
+                 std::atomic<bool>& stop, int id = 0);
+
+        /** @public Deleted copy constructor. */
+        Searcher(const Searcher&) = delete;
+
+        /** @public Deleted move constructor. */
+        Searcher(Searcher&&) = delete;
+
+        /**
+         * A method to search the root position by iterative
+         * deepening.
+         *
+         * @param limits   the search limits
+         * @param reporter a callback for each completed
+         *                 iteration, or nullptr
+         * @return the best move found
+         */
+        Move think(const Limits& limits, Reporter reporter);
+
+        /**
+         * A method to expose the number of nodes visited.
+         *
+         * @return the number of nodes visited
+         */
+        [[nodiscard]]
+        constexpr uint64_t getNodes() const
+        { return nodes; }
+    };
+
+    /**
+     * A function to search a position with Lazy SMP: the main
+     * Searcher and limits.threads - 1 helpers search the same
+     * root on their own copies of the Board, sharing one
+     * transposition table. Only the main Searcher reports,
+     * and it raises the stop flag when it finishes, to stop
+     * the helpers.
+     *
+     * @param root     the position to search
+     * @param tt       the transposition table to share
+     * @param limits   the search limits
+     * @param reporter a callback for each iteration completed
+     *                 by the main Searcher, or nullptr
+     * @param stop     the stop flag, lowered by the caller;
+     *                 raise it from any thread to end the
+     *                 search early
+     * @return the best move found
+     */
+    Move think(const Board& root, TranspositionTable& tt,
+               const Limits& limits, Reporter reporter,
+               std::atomic<bool>& stop);
+}
+
+#endif //CHARON_SEARCH_H
@@ -0,0 +1,202 @@
+//
+// Created by agent on 10/19/2026.
+//
+
+#include "SelfPlay.h"
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Fen.h"
+#include "MoveMake.h"
+#include "Packed.h"
+#include "Search.h"
+#include "Stream.h"
+#include "Zobrist.h"
+
+namespace Charon::SelfPlay {
+    namespace {
+
+        /**
+         * The score of the last iteration of this thread's
+         * search, kept by the reporter.
+         */
+        thread_local int lastScore = 0;
+
+        /**
+         * A function to seed the generator of a game.
+         *
+         * @param seed the seed of the run
+         * @param game the number of the game
+         * @return a nonzero xorshift64* state
+         */
+        constexpr uint64_t seedOf(const uint64_t seed, const uint64_t game) {
+            uint64_t s = (seed + 1) * 0x9E3779B97F4A7C15ULL ^
+                         (game + 1) * 0xD1B54A32D192ED03ULL;
+            if (s == 0) s = 1;
+            for (int i = 0; i < 4; ++i) Zobrist::next(s);
+            return s;
+        }
+
+        /**
+         * A function to determine whether neither side has
+         * the material to mate: no pawns, rooks or queens,
+         * and at most one minor piece.
+         *
+         * @param b the board
+         * @return whether or not the game is a dead draw
+         */
+        inline bool insufficient(const Board& b) {
+            if (b.getPieces<White, Pawn>()  | b.getPieces<Black, Pawn>()  |
+                b.getPieces<White, Rook>()  | b.getPieces<Black, Rook>()  |
+                b.getPieces<White, Queen>() | b.getPieces<Black, Queen>())
+                return false;
+            return highBitCount(b.getAllPieces()) <= 3;
+        }
+
+        /**
+         * A function to read the opening positions of a file.
+         *
+         * @param path      the file of FEN or EPD lines
+         * @param openings  the list to fill with the valid ones
+         * @return whether or not the file could be read
+         */
+        bool readOpenings(const char* const path,
+                          std::vector<std::string>& openings) {
+            const Stream::MappedFile file(path);
+            if (!file.isOpen()) return false;
+            const char* p = file.getData();
+            const char* const e = p + file.getSize();
+            char fen[256];
+            while (p < e) {
+                const char* nl = (const char*) memchr(p, '\n', (size_t) (e - p));
+                if (!nl) nl = e;
+                const size_t n = std::min((size_t) (nl - p), sizeof(fen) - 1);
+                memcpy(fen, p, n);
+                fen[n] = '\0';
+                if (FenUtility::isLegal(fen)) openings.emplace_back(fen);
+                p = nl + 1;
+            }
+            return true;
+        }
+
+        /**
+         * A function to play one game and write its samples.
+         *
+         * @param o        the settings
+         * @param game     the number of the game
+         * @param openings the opening positions, if any
+         * @param tt       the worker's transposition table
+         * @param samples  a buffer of MaxPly Positions
+         * @param out      the shard to write to
+         * @param stats    the totals of the shard
+         */
+        void play(const Options& o, const uint64_t game,
+                  const std::vector<std::string>& openings,
+                  TranspositionTable& tt, Packed::Position* const samples,
+                  Packed::Writer& out, Stats& stats) {
+            uint64_t s = seedOf(o.seed, game);
+            Board board = openings.empty() ?
+                Board::Builder<Default>().build() :
+                FenUtility::parseBoard(
+                    openings[Zobrist::next(s) % openings.size()].c_str()
+                );
+            Search::Limits limits;
+            limits.depth = o.depth;
+            std::atomic<bool> stop(false);
+            if (o.depth > 0) tt.clear();
+            // The search needs room on the State stack past the
+            // last move of the game.
+            const int maxPlies =
+                std::min(o.maxPlies, MaxPly - 2 * Search::MaxDepth);
+            int result = 0, n = 0, ply = 0;
+            for (;; ++ply) {
+                Move moves[256];
+                const int count = MoveFactory::generateMoves<All>(&board, moves);
+                if (count == 0) {
+                    if (board.inCheck())
+                        result = board.currentPlayer() == White ? -1 : 1;
+                    break;
+                }
+                if (board.isDraw() || insufficient(board) || ply >= maxPlies)
+                    break;
+                Move m;
+                int score = 0;
+                if (o.depth <= 0 || ply < o.randomPlies)
+                    m = moves[Zobrist::next(s) % (uint64_t) count];
+                else {
+                    stop.store(false, std::memory_order_relaxed);
+                    m = Search::think(board, tt, limits, [](
+                        const Search::Iteration& it
+                    ) { lastScore = it.score; }, stop);
+                    score = std::clamp(lastScore, -Search::MateValue,
+                                       Search::MateValue);
+                }
+                if (ply >= o.randomPlies && !board.inCheck() &&
+                    Zobrist::next(s) % (uint64_t) o.sampleRate == 0) {
+                    Packed::encode(board, samples[n]);
+                    samples[n++].score = (int16_t) score;
+                }
+                board.applyMove(m);
+            }
+            for (int i = 0; i < n; ++i) {
+                samples[i].result = (int8_t) result;
+                out.write(samples[i]);
+            }
+            ++stats.games;
+            stats.plies     += (uint64_t) ply;
+            stats.positions += (uint64_t) n;
+            stats.whiteWins += result > 0;
+            stats.draws     += result == 0;
+            stats.blackWins += result < 0;
+        }
+    }
+
+    bool generate(const Options& options, Stats& stats) {
+        std::vector<std::string> openings;
+        if (options.openings &&
+            (!readOpenings(options.openings, openings) || openings.empty()))
+            return false;
+        Options o = options;
+        o.shards     = std::max(o.shards, 1);
+        o.sampleRate = std::max(o.sampleRate, 1);
+        o.randomPlies = std::max(o.randomPlies, 0);
+        const int workers = std::clamp(o.threads, 1, o.shards);
+        std::atomic<int> next(0);
+        std::atomic<bool> ok(true);
+        std::mutex lock;
+        std::vector<std::thread> pool;
+        for (int w = 0; w < workers; ++w)
+            pool.emplace_back([&] {
+                TranspositionTable tt(o.depth > 0 ? (size_t) o.megabytes : 1);
+                auto* const samples = new Packed::Position[MaxPly];
+                Stats total;
+                for (int shard; (shard = next.fetch_add(1)) < o.shards;) {
+                    char path[512];
+                    snprintf(path, sizeof(path), "%s-%03d.bin", o.output, shard);
+                    Packed::Writer out(path);
+                    if (!out.isOpen()) {
+                        ok.store(false);
+                        continue;
+                    }
+                    for (uint64_t g = (uint64_t) shard; g < o.games;
+                         g += (uint64_t) o.shards)
+                        play(o, g, openings, tt, samples, out, total);
+                    if (!out.flush()) ok.store(false);
+                }
+                delete[] samples;
+                const std::lock_guard<std::mutex> l(lock);
+                stats.games     += total.games;
+                stats.plies     += total.plies;
+                stats.positions += total.positions;
+                stats.whiteWins += total.whiteWins;
+                stats.draws     += total.draws;
+                stats.blackWins += total.blackWins;
+            });
+        for (std::thread& t : pool) t.join();
+        return ok.load();
+    }
+}
@@ -0,0 +1,111 @@
+//
+// Created by agent on 10/19/2026.
+//
+
+#pragma once
+#ifndef CHARON_SELFPLAY_H
+#define CHARON_SELFPLAY_H
+
+#include <cstdint>
+
+namespace Charon::SelfPlay {
+
+    /**
+     * <summary>
+     * A struct to hold the settings of a self-play run. The
+     * output depends only on the seed, the number of games,
+     * the number of shards and the way the moves are chosen,
+     * and not on the number of threads.
+     * </summary>
+     *
+     * @struct Options
+     */
+    struct Options final {
+        uint64_t    seed        = 1;
+        uint64_t    games       = 1000;
+        int         threads     = 1;
+        int         shards      = 16;
+
+        /** The search depth of each move, or zero for random play. */
+        int         depth       = 0;
+
+        /**
+         * The random moves played at the start of each game,
+         * before the search takes over and before positions
+         * are sampled.
+         */
+        int         randomPlies = 8;
+
+        /** One position in this many is kept, on average. */
+        int         sampleRate  = 4;
+
+        /** The plies after which a game is called a draw. */
+        int         maxPlies    = 400;
+
+        /** The transposition table of each thread, in megabytes. */
+        int         megabytes   = 4;
+
+        /**
+         * A file of FEN or EPD lines to start games from, or
+         * nullptr for the standard start position.
+         */
+        const char* openings    = nullptr;
+
+        /**
+         * The prefix of the shard files: shard 3 of "data"
+         * is written to data-003.bin.
+         */
+        const char* output      = "selfplay";
+    };
+
+    /**
+     * <summary>
+     * A struct to hold the totals of a self-play run.
+     * </summary>
+     *
+     * @struct Stats
+     */
+    struct Stats final {
+        uint64_t games     = 0;
+        uint64_t plies     = 0;
+        uint64_t positions = 0;
+        uint64_t whiteWins = 0;
+        uint64_t draws     = 0;
+        uint64_t blackWins = 0;
+    };
+
+    /**
+     * <summary>
+     *  <p>
+     * A function to play games against itself on a pool of
+     * worker threads, and to write a sample of their
+     * positions, labeled with the results, as Packed
+     * Positions.
+     *  </p>
+     *  <p>
+     * Game g belongs to shard g mod shards, and each shard is
+     * one file, played by one worker in order of its games.
+     * Each game draws its opening, its random moves and its
+     * samples from a generator seeded by the seed and g alone,
+     * and a searching game clears its worker's table first, so
+     * a shard comes out the same whichever worker plays it.
+     * The workers share nothing but the next shard to take, so
+     * the run scales with threads up to the number of shards.
+     *  </p>
+     *  <p>
+     * A game ends in mate, stalemate, a fifty-move or
+     * repetition draw, bare minor pieces, or a draw at
+     * maxPlies. A sample is never taken in check, and a
+     * searching game labels it with the score of the search.
+     *  </p>
+     * </summary>
+     *
+     * @param options the settings
+     * @param stats   the totals to add to
+     * @return whether or not the openings could be read and
+     * every shard written
+     */
+    bool generate(const Options& options, Stats& stats);
+}
+
+#endif //CHARON_SELFPLAY_H
@@ -0,0 +1,228 @@
+//
+// Created by agent on 10/19/2026.
+//
+
+#include "Stream.h"
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+#ifndef WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Charon::Stream {
+    namespace {
+
+        /**
+         * <summary>
+         * A struct to hold one chunk of input lines on its way
+         * through the pool, and the output of its lines.
+         * </summary>
+         *
+         * @struct Chunk
+         */
+        struct Chunk final {
+            const char* begin  = nullptr;
+            const char* end    = nullptr;
+            bool        done   = false;
+            std::string input;
+            std::string output;
+        };
+
+        /**
+         * A function to run each line of a chunk through a
+         * handler.
+         *
+         * @param c       the chunk
+         * @param handler the callback for each line
+         */
+        void process(Chunk& c, const LineHandler handler) {
+            c.output.clear();
+            for (const char* p = c.begin; p < c.end;) {
+                const char* nl = (const char*)
+                    memchr(p, '\n', (size_t) (c.end - p));
+                if (!nl) nl = c.end;
+                size_t n = (size_t) (nl - p);
+                if (n > 0 && p[n - 1] == '\r') --n;
+                handler(p, n, c.output);
+                p = nl + 1;
+            }
+        }
+
+        /**
+         * A function to find the end of the chunk that starts
+         * at an offset of a buffer: ChunkBytes on, and then to
+         * the end of the line.
+         *
+         * @param data  the buffer
+         * @param size  the size of the buffer
+         * @param start the offset of the chunk
+         * @return the offset just past the chunk
+         */
+        size_t chunkEnd(const char* const data, const size_t size,
+                        const size_t start) {
+            if (size - start <= ChunkBytes) return size;
+            const char* const nl = (const char*) memchr(
+                data + start + ChunkBytes, '\n',
+                size - start - ChunkBytes
+            );
+            return nl ? (size_t) (nl - data) + 1 : size;
+        }
+    }
+
+    MappedFile::MappedFile(const char* const path) :
+    data(nullptr), size(0), open(false) {
+        if (!path) return;
+#ifdef WIN32
+        FILE* const f = fopen(path, "rb");
+        if (!f) return;
+        fseek(f, 0, SEEK_END);
+        size = (size_t) ftell(f);
+        fseek(f, 0, SEEK_SET);
+        char* const buffer = new char[size + 1];
+        size = fread(buffer, 1, size, f);
+        fclose(f);
+        data = buffer;
+#else
+        const int fd = ::open(path, O_RDONLY);
+        if (fd < 0) return;
+        struct stat st{};
+        if (fstat(fd, &st) != 0) {
+            close(fd);
+            return;
+        }
+        size = (size_t) st.st_size;
+        if (size > 0) {
+            void* const mapping =
+                mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+            close(fd);
+            if (mapping == MAP_FAILED) {
+                size = 0;
+                return;
+            }
+            madvise(mapping, size, MADV_SEQUENTIAL);
+            data = (const char*) mapping;
+        } else close(fd);
+#endif
+        open = true;
+    }
+
+    MappedFile::~MappedFile() {
+#ifdef WIN32
+        delete[] data;
+#else
+        if (data) munmap((void*) data, size);
+#endif
+    }
+
+    bool run(const char* const path, const int threads,
+             const LineHandler handler, FILE* const out) {
+        // Map the whole file when there is one. Standard input
+        // is read a chunk at a time instead.
+        const MappedFile file(path);
+        if (path && !file.isOpen()) return false;
+        const char* const data = file.getData();
+        const size_t size = file.getSize();
+        const int workers = threads < 1 ? 1 : threads;
+        const uint64_t window = (uint64_t) workers * ChunksPerWorker;
+        std::vector<Chunk> ring(window);
+        std::deque<Chunk*> queue;
+        std::mutex lock;
+        std::condition_variable workReady, chunkDone, slotFree;
+        uint64_t nextRead = 0, nextWrite = 0;
+        bool finished = false;
+
+        std::vector<std::thread> pool;
+        for (int i = 0; i < workers; ++i)
+            pool.emplace_back([&] {
+                for (;;) {
+                    std::unique_lock<std::mutex> l(lock);
+                    workReady.wait(l, [&] { return !queue.empty() || finished; });
+                    if (queue.empty()) return;
+                    Chunk* const c = queue.front();
+                    queue.pop_front();
+                    l.unlock();
+                    process(*c, handler);
+                    l.lock();
+                    c->done = true;
+                    l.unlock();
+                    chunkDone.notify_one();
+                }
+            });
+        std::thread writer([&] {
+            for (;;) {
+                std::unique_lock<std::mutex> l(lock);
+                Chunk& c = ring[nextWrite % window];
+                chunkDone.wait(l, [&] {
+                    return c.done || (finished && nextWrite == nextRead);
+                });
+                if (!c.done) return;
+                l.unlock();
+                fwrite(c.output.data(), 1, c.output.size(), out);
+                l.lock();
+                c.done = false;
+                ++nextWrite;
+                l.unlock();
+                slotFree.notify_one();
+            }
+        });
+
+        // The slot after the last one read is free once the
+        // writer has written it.
+        std::string carry;
+        size_t offset = 0;
+        for (;;) {
+            std::unique_lock<std::mutex> l(lock);
+            slotFree.wait(l, [&] { return nextRead - nextWrite < window; });
+            Chunk& c = ring[nextRead % window];
+            l.unlock();
+            if (path) {
+                if (offset >= size) break;
+                const size_t end = chunkEnd(data, size, offset);
+                c.begin = data + offset;
+                c.end   = data + end;
+                offset  = end;
+            } else {
+                // Keep the unfinished last line for the next
+                // chunk.
+                c.input.assign(carry);
+                c.input.resize(carry.size() + ChunkBytes);
+                const size_t n = fread(&c.input[carry.size()], 1,
+                                       ChunkBytes, stdin);
+                c.input.resize(carry.size() + n);
+                if (c.input.empty()) break;
+                size_t cut = c.input.size();
+                if (n > 0) {
+                    const size_t nl = c.input.rfind('\n');
+                    cut = nl == std::string::npos ? 0 : nl + 1;
+                }
+                carry.assign(c.input, cut, std::string::npos);
+                c.input.resize(cut);
+                if (cut == 0) continue;
+                c.begin = c.input.data();
+                c.end   = c.begin + cut;
+            }
+            l.lock();
+            ++nextRead;
+            queue.push_back(&c);
+            l.unlock();
+            workReady.notify_one();
+        }
+        {
+            const std::lock_guard<std::mutex> l(lock);
+            finished = true;
+        }
+        workReady.notify_all();
+        chunkDone.notify_all();
+        for (std::thread& t : pool) t.join();
+        writer.join();
+        fflush(out);
+        return true;
+    }
+}
@@ -0,0 +1,151 @@
+//
+// Created by agent on 10/19/2026.
+//
+
+#pragma once
+#ifndef CHARON_STREAM_H
+#define CHARON_STREAM_H
+
+#include <cstddef>
+#include <cstdio>
+#include <string>
+
+namespace Charon::Stream {
+
+    /**
+     * The number of input bytes handed to a worker at a time.
+     * A chunk always ends on a line break, so it may run a
+     * line longer.
+     */
+    constexpr size_t ChunkBytes = 1U << 16U;
+
+    /**
+     * The number of chunks each worker may have in flight
+     * between the reader and the writer. It bounds the
+     * reorder buffer, and with it the memory a stream uses.
+     */
+    constexpr int ChunksPerWorker = 4;
+
+    /**
+     * <summary>
+     * A MappedFile maps a whole file into memory for reading,
+     * and unmaps it when it goes out of scope. Where there is
+     * no mmap, the file is read into a buffer instead.
+     * </summary>
+     *
+     * @class MappedFile
+     * @author agent
+     * @version 10.19.2026
+     */
+    class MappedFile final {
+    private:
+
+        /**
+         * @private
+         * The contents of the file, or nullptr if it is empty
+         * or could not be opened.
+         */
+        const char* data;
+
+        /**
+         * @private
+         * The size of the file in bytes.
+         */
+        size_t size;
+
+        /**
+         * @private
+         * Whether or not the file could be opened.
+         */
+        bool open;
+    public:
+
+        /**
+         * A public constructor for a MappedFile.
+         *
+         * @param path the file to map, or nullptr for none
+         */
+        explicit MappedFile(const char* path);
+
+        /** @public Destructor. */
+        ~MappedFile();
+
+        /** @public Deleted copy constructor. */
+        MappedFile(const MappedFile&) = delete;
+
+        /** @public Deleted move constructor. */
+        MappedFile(MappedFile&&) = delete;
+
+        /**
+         * A method to determine whether the file could be
+         * opened and mapped.
+         *
+         * @return whether or not the file is readable
+         */
+        [[nodiscard]]
+        constexpr bool isOpen() const
+        { return open; }
+
+        /**
+         * A method to expose the contents of the file.
+         *
+         * @return the first byte of the file
+         */
+        [[nodiscard]]
+        constexpr const char* getData() const
+        { return data; }
+
+        /**
+         * A method to expose the size of the file.
+         *
+         * @return the size of the file in bytes
+         */
+        [[nodiscard]]
+        constexpr size_t getSize() const
+        { return size; }
+    };
+
+    /**
+     * A callback to process one input line. It appends its
+     * output, line break included, to a buffer that is
+     * written in input order.
+     *
+     * @param line   the line, without its line break
+     * @param length the length of the line
+     * @param out    the output buffer of the line's chunk
+     */
+    typedef void (*LineHandler)(const char* line, size_t length,
+                                std::string& out);
+
+    /**
+     * <summary>
+     *  <p>
+     * A function to run every line of an input through a
+     * handler on a pool of worker threads, and to write the
+     * outputs in input order.
+     *  </p>
+     *  <p>
+     * The calling thread reads the input in chunks of whole
+     * lines, from a mapped file, or else from standard input.
+     * Each worker takes the next chunk, runs its lines through
+     * the handler into the chunk's own output buffer, and
+     * hands it to a writer thread, which writes the chunks in
+     * order as they complete. The chunks live in a ring of
+     * ChunksPerWorker slots per worker: the reader waits for
+     * the writer when the ring is full, so a slow worker holds
+     * back at most one ring of chunks.
+     *  </p>
+     * </summary>
+     *
+     * @param path    the file to read, or nullptr for
+     *                standard input
+     * @param threads the number of workers
+     * @param handler the callback for each line
+     * @param out     the file to write to
+     * @return whether or not the input could be read
+     */
+    bool run(const char* path, int threads,
+             LineHandler handler, FILE* out);
+}
+
+#endif //CHARON_STREAM_H
@@ -0,0 +1,205 @@
+//
+// Created by agent on 10/19/2026.
+//
+
+#pragma once
+#ifndef CHARON_TIMEMANAGER_H
+#define CHARON_TIMEMANAGER_H
+
+#include <cstdint>
+#include <algorithm>
+#include <chrono>
+
+namespace Charon {
+
+    /**
+     * The milliseconds held back from every timed move, for
+     * the time lost between the engine and the clock.
+     */
+    constexpr int64_t MoveOverhead = 10;
+
+    /**
+     * The number of nodes between two looks at the clock. A
+     * power of two.
+     */
+    constexpr uint64_t PollInterval = 1024;
+
+    /**
+     * <summary>
+     *  <p>
+     * A TimeManager decides when a search must end. It keeps
+     * three kinds of limit, any of which may be absent:
+     *  </p>
+     *  <ul>
+     *   <li>a node limit, checked at every node, so that a
+     *   single-threaded search to a fixed number of nodes
+     *   visits the same nodes on every run</li>
+     *   <li>a hard time limit, after which the search is
+     *   aborted, checked every PollInterval nodes</li>
+     *   <li>a soft time limit, after which no new iteration
+     *   of iterative deepening is begun</li>
+     *  </ul>
+     *  <p>
+     * A fixed movetime sets both time limits to the same
+     * budget. A clock sets the soft limit to a share of the
+     * time left and stretches it while the best move is
+     * unstable: a search that keeps changing its mind has not
+     * yet found the move, and is worth more time.
+     *  </p>
+     * </summary>
+     *
+     * @class TimeManager
+     * @author agent
+     * @version 10.19.2026
+     */
+    class TimeManager final {
+    private:
+
+        /**
+         * @private
+         * The time the search began.
+         */
+        std::chrono::steady_clock::time_point start;
+
+        /**
+         * @private
+         * The milliseconds a stable search should take, or
+         * zero for no limit.
+         */
+        int64_t optimum;
+
+        /**
+         * @private
+         * The milliseconds after which the search is aborted,
+         * or zero for no limit.
+         */
+        int64_t hardLimit;
+
+        /**
+         * @private
+         * The number of nodes after which the search is
+         * aborted, or zero for no limit.
+         */
+        uint64_t nodeLimit;
+
+        /**
+         * @private
+         * A decaying count of the iterations whose best move
+         * differed from the one before.
+         */
+        double instability;
+    public:
+
+        /**
+         * A public constructor for a TimeManager with no
+         * limits.
+         */
+        TimeManager() :
+        start(std::chrono::steady_clock::now()),
+        optimum(0),
+        hardLimit(0),
+        nodeLimit(0),
+        instability(0)
+        {  }
+
+        /**
+         * A method to start the clock of a search and set its
+         * limits. Zero means no limit throughout.
+         *
+         * @param time      the milliseconds left on the clock
+         *                  of the player to move
+         * @param inc       that player's increment
+         * @param movesToGo the moves to the next time control
+         * @param moveTime  the milliseconds to spend exactly
+         * @param nodes     the most nodes to search
+         */
+        inline void begin(const int64_t time, const int64_t inc,
+                          const int movesToGo, const int64_t moveTime,
+                          const uint64_t nodes) {
+            start       = std::chrono::steady_clock::now();
+            optimum     = hardLimit = 0;
+            nodeLimit   = nodes;
+            instability = 0;
+            if (moveTime > 0) {
+                optimum = hardLimit =
+                    std::max<int64_t>(moveTime - MoveOverhead, 1);
+                return;
+            }
+            if (time <= 0) return;
+            // Spend an even share of the clock over the moves
+            // left, plus most of the increment, but never more
+            // than a few times that share on one move, and never
+            // the last of the clock.
+            const int64_t left = std::max<int64_t>(time - MoveOverhead, 1);
+            const int64_t share = left / (movesToGo > 0 ?
+                std::min(movesToGo, 50) : 30) + inc * 3 / 4;
+            hardLimit = std::clamp<int64_t>(share * 3, 1, left * 3 / 4 + 1);
+            // An iteration takes several times as long as the one
+            // before it, so one begun after half the share is
+            // unlikely to finish in time.
+            optimum = std::min(share / 2 + 1, hardLimit);
+        }
+
+        /**
+         * A method to find the milliseconds spent since the
+         * search began.
+         *
+         * @return the elapsed milliseconds
+         */
+        [[nodiscard]]
+        inline int64_t elapsed() const {
+            return std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - start
+            ).count();
+        }
+
+        /**
+         * A method to find the seconds spent since the search
+         * began, for reports.
+         *
+         * @return the elapsed seconds
+         */
+        [[nodiscard]]
+        inline double seconds() const {
+            return std::chrono::duration<double>(
+                std::chrono::steady_clock::now() - start
+            ).count();
+        }
+
+        /**
+         * A method to decide, at a node, whether the search
+         * must be aborted. The clock is read only every
+         * PollInterval nodes.
+         *
+         * @param nodes the nodes visited so far
+         * @return whether or not a hard limit is spent
+         */
+        [[nodiscard]]
+        inline bool expired(const uint64_t nodes) const {
+            return (nodeLimit > 0 && nodes >= nodeLimit) ||
+                   (hardLimit > 0 && (nodes & (PollInterval - 1)) == 0 &&
+                    elapsed() >= hardLimit);
+        }
+
+        /**
+         * A method to decide, after an iteration, whether to
+         * begin another.
+         *
+         * @param bestMoveChanged whether the iteration's best
+         *                        move differs from the last one
+         * @return whether or not the search should end now
+         */
+        [[nodiscard]]
+        inline bool finished(const bool bestMoveChanged) {
+            instability = instability / 2 + bestMoveChanged;
+            if (optimum == 0) return false;
+            // A stable search stops at the optimum, and an
+            // unstable one may take up to three times as long,
+            // within the hard limit.
+            const auto soft = (int64_t) ((double) optimum * (1 + instability));
+            return elapsed() >= std::min(soft, hardLimit);
+        }
+    };
+}
+
+#endif //CHARON_TIMEMANAGER_H
@@ -0,0 +1,224 @@
+//
+// Created by agent on 10/19/2026.
+//
+
+#pragma once
+#ifndef CHARON_TRANSPOSITIONTABLE_H
+#define CHARON_TRANSPOSITIONTABLE_H
+
+#include <cstdint>
+#include <cstddef>
+#include <atomic>
+#include "Move.h"
+
+namespace Charon {
+
+    /** The kinds of score bound, enumerated. */
+    enum Bound : uint8_t
+    { NoBound, Upper, Lower, Exact };
+
+    /**
+     * <summary>
+     * A struct to hold one transposition table entry: what a
+     * search of a position found, and how far it looked.
+     * </summary>
+     *
+     * @struct TTEntry
+     */
+    struct TTEntry final {
+        uint64_t key;
+        uint16_t move;
+        int16_t  score;
+        int8_t   depth;
+        Bound    bound;
+    };
+
+    /**
+     * <summary>
+     * A struct to hold one slot of the table: an entry packed
+     * into a data word, and the entry's key exclusive-or'ed
+     * with that word.
+     * </summary>
+     *
+     * @struct TTSlot
+     */
+    struct TTSlot final {
+        std::atomic<uint64_t> check;
+        std::atomic<uint64_t> data;
+    };
+
+    /**
+     * <summary>
+     *  <p>
+     * A TranspositionTable is a fixed-size, power-of-two array
+     * of TTSlots indexed by the low bits of a position's
+     * Zobrist key. A newer entry always replaces an older one
+     * unless the older one holds the same position at a
+     * greater depth.
+     *  </p>
+     *  <p>
+     * The table is shared by every search thread without
+     * locks. Each slot is written as two independent words,
+     * so a reader racing a writer may see the key of one
+     * entry beside the data of another. Storing the key
+     * exclusive-or'ed with the data makes such a torn slot
+     * fail the key check, and it reads as a miss.
+     *  </p>
+     * </summary>
+     *
+     * @class TranspositionTable
+     * @author agent
+     * @version 10.19.2026
+     */
+    class TranspositionTable final {
+    private:
+
+        /**
+         * @private
+         * The slots.
+         */
+        TTSlot* table;
+
+        /**
+         * @private
+         * The number of entries minus one.
+         */
+        uint64_t mask;
+
+        /**
+         * @private
+         * A function to pack the data of an entry into one
+         * word.
+         *
+         * @param e the entry
+         * @return the packed data
+         */
+        static constexpr uint64_t pack(const TTEntry& e) {
+            return (uint64_t) e.move |
+                   (uint64_t) (uint16_t) e.score << 16U |
+                   (uint64_t) (uint8_t)  e.depth << 32U |
+                   (uint64_t) e.bound << 40U;
+        }
+
+        /**
+         * @private
+         * A function to unpack a data word into an entry.
+         *
+         * @param key  the key of the entry
+         * @param data the packed data
+         * @return the entry
+         */
+        static constexpr TTEntry unpack(const uint64_t key,
+                                        const uint64_t data) {
+            return TTEntry {
+                key,
+                (uint16_t) data,
+                (int16_t) (uint16_t) (data >> 16U),
+                (int8_t) (uint8_t) (data >> 32U),
+                (Bound) (uint8_t) (data >> 40U)
+            };
+        }
+
+        /**
+         * @private
+         * A method to read the slot of a key.
+         *
+         * @param key the Zobrist key of the position
+         * @return the entry in the slot, with the key it
+         * claims to hold
+         */
+        inline TTEntry read(const uint64_t key) const {
+            const TTSlot& s = table[key & mask];
+            const uint64_t d = s.data.load(std::memory_order_relaxed);
+            return unpack(s.check.load(std::memory_order_relaxed) ^ d, d);
+        }
+    public:
+
+        /**
+         * A public constructor for a TranspositionTable.
+         *
+         * @param megabytes the size of the table, rounded down
+         * to a power of two
+         */
+        explicit TranspositionTable(const size_t megabytes) {
+            size_t n = 1;
+            while (n * 2 * sizeof(TTSlot) <= megabytes << 20U) n *= 2;
+            table = new TTSlot[n];
+            mask  = n - 1;
+            clear();
+        }
+
+        /** @public Destructor. */
+        ~TranspositionTable() { delete[] table; }
+
+        /** @public Deleted copy constructor. */
+        TranspositionTable(const TranspositionTable&) = delete;
+
+        /** @public Deleted move constructor. */
+        TranspositionTable(TranspositionTable&&) = delete;
+
+        /**
+         * A method to empty the table.
+         */
+        inline void clear() {
+            for (uint64_t i = 0; i <= mask; ++i) {
+                table[i].check.store(0, std::memory_order_relaxed);
+                table[i].data.store(0, std::memory_order_relaxed);
+            }
+        }
+
+        /**
+         * A method to look up a position.
+         *
+         * @param key the Zobrist key of the position
+         * @param e   the entry to fill on a hit
+         * @return whether or not the position was found
+         */
+        inline bool probe(const uint64_t key, TTEntry& e) const {
+            e = read(key);
+            return e.key == key && e.bound != NoBound;
+        }
+
+        /**
+         * A method to record what a search found.
+         *
+         * @param key   the Zobrist key of the position
+         * @param move  the best move found, or NullMove
+         * @param score the score, relative to the position
+         * @param depth the depth searched
+         * @param bound the kind of bound the score is
+         */
+        inline void store(const uint64_t key, const Move& move,
+                          const int score, const int depth,
+                          const Bound bound) {
+            const TTEntry e = read(key);
+            if (e.key == key && e.depth > depth && bound != Exact)
+                return;
+            // Keep the old move when there is no new one.
+            const uint16_t m = move != NullMove || e.key != key ?
+                (uint16_t) move.getManifest() : e.move;
+            const uint64_t d = pack(TTEntry {
+                key, m, (int16_t) score, (int8_t) depth, bound
+            });
+            TTSlot& s = table[key & mask];
+            s.check.store(key ^ d, std::memory_order_relaxed);
+            s.data.store(d, std::memory_order_relaxed);
+        }
+
+        /**
+         * A method to estimate how full the table is.
+         *
+         * @return the number of used entries per thousand
+         */
+        [[nodiscard]]
+        inline int hashfull() const {
+            int used = 0;
+            for (int i = 0; i < 1000; ++i)
+                used += table[i & mask].data.load(
+                    std::memory_order_relaxed) >> 40U != NoBound;
+            return used;
+        }
+    };
+}
+
+#endif //CHARON_TRANSPOSITIONTABLE_H
@@ -0,0 +1,113 @@
+//
+// Created by agent on 10/19/2026.
+//
+
+#pragma once
+#ifndef CHARON_ZOBRIST_H
+#define CHARON_ZOBRIST_H
+
+#include <cstdint>
+#include "ChaosMagic.h"
+#include "Utility.h"
+
+namespace Charon::Zobrist {
+
+    /**
+     * <summary>
+     *  <p><br/>
+     * A set of random keys, one per (alliance, piece type,
+     * square), castling-rights mask and en passant square,
+     * plus one for the side to move. A position's key is
+     * the exclusive-or of the keys of its features, so a
+     * move updates it with a handful of xors.
+     *  </p>
+     *  <p>
+     * The tables are filled at compile time by a xorshift64*
+     * generator with a fixed seed, so keys are the same on
+     * every build and every run.
+     *  </p>
+     * </summary>
+     *
+     * @struct Keys
+     */
+    struct Keys final {
+        uint64_t pieces[2][6][BoardLength];
+        uint64_t castling[16];
+        uint64_t enPassant[BoardLength + 1];
+        uint64_t side;
+    };
+
+    /**
+     * A function to step a xorshift64* generator.
+     *
+     * @param s the generator state, updated in place
+     * @return the next pseudo-random number
+     */
+    constexpr uint64_t next(uint64_t& s) {
+        s ^= s >> 12U;
+        s ^= s << 25U;
+        s ^= s >> 27U;
+        return s * 0x2545F4914F6CDD1DULL;
+    }
+
+    /**
+     * A function to fill the key tables.
+     *
+     * @return the key tables
+     */
+    constexpr Keys makeKeys() {
+        Keys k{};
+        uint64_t s = 0x9E3779B97F4A7C15ULL;
+        for (auto& alliance : k.pieces)
+            for (auto& pieceType : alliance)
+                for (uint64_t& sq : pieceType)
+                    sq = next(s);
+        // No rights hashes to zero.
+        for (int i = 1; i < 16; ++i)
+            k.castling[i] = next(s);
+        // NullSQ hashes to zero.
+        for (int i = 0; i < BoardLength; ++i)
+            k.enPassant[i] = next(s);
+        k.side = next(s);
+        return k;
+    }
+
+    /** The key tables. */
+    constexpr Keys Table = makeKeys();
+
+    /**
+     * A function to look up the key of a piece on a square.
+     *
+     * @param a  the alliance of the piece
+     * @param pt the type of the piece
+     * @param sq the square
+     * @return the key of the given piece on the given square
+     */
+    constexpr uint64_t piece(const int a, const int pt, const int sq)
+    { return Table.pieces[a][pt][sq]; }
+
+    /**
+     * A function to look up the key of a set of castling
+     * rights.
+     *
+     * @param rights the castling-rights mask
+     * @return the key of the given rights
+     */
+    constexpr uint64_t castling(const int rights)
+    { return Table.castling[rights]; }
+
+    /**
+     * A function to look up the key of an en passant square.
+     *
+     * @param sq the square of the pawn that just jumped, or
+     *           NullSQ
+     * @return the key of the given square
+     */
+    constexpr uint64_t enPassant(const int sq)
+    { return Table.enPassant[sq]; }
+
+    /** The key of Black to move. */
+    constexpr uint64_t Side = Table.side;
+}
+
+#endif //CHARON_ZOBRIST_H
@@ -1,13 +1,26 @@
 #include "ChaosMagic.h"
 #include "MoveMake.h"
 #include "Fen.h"
+#include "Batch.h"
+#include "QuadBoard.h"
+#include "Stream.h"
+#include "Pgn.h"
+#include "Notation.h"
+#include "Packed.h"
+#include "Polyglot.h"
 #ifdef WIN32
 #include <Windows.h>
 #else
 #include <unistd.h>
 #endif
 #include <time.h>
+#include <atomic>
+#include <chrono>
+#include <cstring>
 #include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
 #include <fstream>
 #include <sstream>
 
@@ -15,32 +28,68 @@ using std::cout;
 using std::flush;
 using namespace Charon;
 
+/** A perft driver. */
+typedef uint64_t (*PerftDriver)(Board*, int);
+
 int displayUsage();
-int charPerft(int, int, const char**);
-int charVerify(int, int, const char**);
+int charPerft(PerftDriver, int, int, const char**);
+int charVerify(PerftDriver, int, int, const char**);
+int charCheckBench(int, int, const char**);
+int charStream(PerftDriver, int, int, const char**);
+int charPgn(int, const char**);
+int charNotationBench(int, int, const char**);
+int charPackedBench(int, int, const char**);
+int charBookBench(int, int, const char**);
+void streamLine(const char*, size_t, std::string&);
 uint64_t perft(Board*, int);
+uint64_t perftBatch(Board*, int);
+uint64_t perftQuad(Board*, int);
+uint64_t perftCopyMake(QuadBoard*, int);
 
 int main(const int argc, const char** const argv) {
     if(argc <= 2 ||
        argv[1][0] != '-' ||
        (argv[1][1] != 'v' &&
-       argv[1][1] != 'p'))
+       argv[1][1] != 'p' &&
+       argv[1][1] != 's' &&
+       argv[1][1] != 'g' &&
+       argv[1][1] != 'n' &&
+       argv[1][1] != 'd' &&
+       argv[1][1] != 'o' &&
+       argv[1][1] != 'c'))
         return displayUsage();
+    if(argv[1][1] == 'c')
+        return charCheckBench(atoi(argv[2]), argc, argv);
+    if(argv[1][1] == 'g')
+        return charPgn(argc, argv);
+    if(argv[1][1] == 'n')
+        return charNotationBench(atoi(argv[2]), argc, argv);
+    if(argv[1][1] == 'd')
+        return charPackedBench(atoi(argv[2]), argc, argv);
+    if(argv[1][1] == 'o')
+        return charBookBench(atoi(argv[2]), argc, argv);
+    const PerftDriver driver =
+        argv[1][2] == '\0'? perft:
+        argv[1][2] == 'b' ? perftBatch:
+        argv[1][2] == 'q' ? perftQuad :
+                            nullptr;
+    if(!driver) return displayUsage();
     int n = atoi(argv[2]);
     if(n <= 0) displayUsage();
-    return argv[1][1] == 'p'? charPerft(n, argc, argv) :
-           argv[1][1] == 'v'? charVerify(n, argc, argv):
+    return argv[1][1] == 'p'? charPerft(driver, n, argc, argv) :
+           argv[1][1] == 'v'? charVerify(driver, n, argc, argv):
+           argv[1][1] == 's'? charStream(driver, n, argc, argv):
            displayUsage();
 }
 
-inline int charPerft(const int n, const int argc, const char** const argv) {
+inline int charPerft(const PerftDriver driver, const int n,
+                     const int argc, const char** const argv) {
     double start = clock();
     Witchcraft::init();
     double stop = clock() - start;
-    State x;
     Board b = (argc == 3) ?
-              Board::Builder<Default>(x).build() :
-              FenUtility::parseBoard(argv[3], &x);
+              Board::Builder<Default>().build() :
+              FenUtility::parseBoard(argv[3]);
     cout << '\n'
          << "     @@@    @@\n"
          << "   @@   @@  @@\n"
@@ -59,7 +108,7 @@ inline int charPerft(const int n, const int argc, const char** const argv) {
     uint64_t j;
     for (int i = 1; i <= n; ++i) {
         start = clock();
-        j = perft(&b, i);
+        j = driver(&b, i);
         stop = clock() - start;
         cout << "\n\tperft(" << i << ") - ";
         printf("%6.3f", (double) stop / (double) CLOCKS_PER_SEC);
@@ -78,31 +127,414 @@ uint64_t perft(Board* const b, int depth) {
     j = MoveFactory::generateMoves<All>(b, m);
     if(depth <= 1) return j;
     for(Move* n = m; n->getManifest() != 0; ++n) {
-        State x;
-        b->applyMove(*n, x);
+        b->applyMove(*n);
         i += perft(b, depth - 1);
         b->retractMove(*n);
     }
     return i;
 }
 
-inline int charVerify(const int n, const int argc, const char** const argv) {
+uint64_t perftBatch(Board* const b, int depth) {
+    Move m[256];
+    uint64_t i = 0, j;
+    j = MoveFactory::generateMoves<All>(b, m);
+    if(depth <= 1) return j;
+    if(depth > 2) {
+        for(Move* n = m; n->getManifest() != 0; ++n) {
+            b->applyMove(*n);
+            i += perftBatch(b, depth - 1);
+            b->retractMove(*n);
+        }
+        return i;
+    }
+    // Gather the children into batches and count
+    // all of their leaves at once.
+    BoardBatch batch(~b->currentPlayer());
+    int counts[BatchWidth];
+    for(Move* n = m; n->getManifest() != 0; ++n) {
+        b->applyMove(*n);
+        batch.push(*b);
+        b->retractMove(*n);
+        if(batch.full() || (n + 1)->getManifest() == 0) {
+            MoveFactory::countMoves(batch, counts);
+            for(int l = 0; l < batch.size(); ++l) i += counts[l];
+            batch.clear();
+        }
+    }
+    return i;
+}
+
+uint64_t perftQuad(Board* const b, const int depth) {
+    QuadBoard q(*b);
+    return perftCopyMake(&q, depth);
+}
+
+uint64_t perftCopyMake(QuadBoard* const b, int depth) {
+    Move m[256];
+    uint64_t i = 0, j;
+    j = MoveFactory::generateMoves<All>(b, m);
+    if(depth <= 1) return j;
+    for(Move* n = m; n->getManifest() != 0; ++n) {
+        QuadBoard x(*b, *n);
+        i += perftCopyMake(&x, depth - 1);
+    }
+    return i;
+}
+
+inline int charVerify(const PerftDriver driver, const int n,
+                      const int argc, const char** const argv) {
     Witchcraft::init();
-    State x;
     if(argc == 3) return displayUsage();
     const uint64_t q = atoll(argv[4]);
     const int z      = atoi(argv[5]);
     if(q <= 0) return displayUsage();
-    Board b = FenUtility::parseBoard(argv[3], &x);
-    uint64_t  j = perft(&b, n);
+    Board b = FenUtility::parseBoard(argv[3]);
+    uint64_t  j = driver(&b, n);
     cout << (z? (int) z: (char)'-')      << ' '
          << (j == q? "passed": "failed") << '\n';
     Witchcraft::destroy();
     return 0;
 }
 
+/** Check counts and timings for charCheckBench. */
+struct CheckBench {
+    uint64_t moves = 0, checks = 0, mismatches = 0;
+    double predicate = 0, applied = 0;
+};
+
+/**
+ * Walk the perft tree to the given depth and, at every
+ * node, test each move for check twice: once with
+ * givesCheck and once by applying the move, testing the
+ * enemy king and retracting.
+ */
+template<Alliance A>
+void checkBench(Board* const b, const int depth, CheckBench& r) {
+    Move m[256];
+    const int n = MoveFactory::generateMoves<All>(b, m);
+    bool predicted[256];
+    clock_t start = clock();
+    const CheckInfo ci = b->checkInfo();
+    for(int i = 0; i < n; ++i)
+        predicted[i] = b->givesCheck(m[i], ci);
+    r.predicate += clock() - start;
+    start = clock();
+    for(int i = 0; i < n; ++i) {
+        b->applyMove(m[i]);
+        const bool check = attacksOn<~A, King>(
+            b, bitScanFwd(b->getPieces<~A, King>())
+        );
+        b->retractMove(m[i]);
+        r.checks     += check;
+        r.mismatches += check != predicted[i];
+    }
+    r.applied += clock() - start;
+    r.moves += n;
+    if(depth <= 1) return;
+    for(int i = 0; i < n; ++i) {
+        b->applyMove(m[i]);
+        checkBench<~A>(b, depth - 1, r);
+        b->retractMove(m[i]);
+    }
+}
+
+inline int charCheckBench(const int n, const int argc,
+                          const char** const argv) {
+    if(n <= 0) return displayUsage();
+    Witchcraft::init();
+    Board b = (argc == 3) ?
+              Board::Builder<Default>().build() :
+              FenUtility::parseBoard(argv[3]);
+    CheckBench r;
+    if(b.currentPlayer() == White) checkBench<White>(&b, n, r);
+    else checkBench<Black>(&b, n, r);
+    cout << "\n\tmoves tested      - " << r.moves
+         << "\n\tchecking moves    - " << r.checks
+         << "\n\tmismatches        - " << r.mismatches
+         << "\n\tgivesCheck        - ";
+    printf("%6.3f", r.predicate / CLOCKS_PER_SEC);
+    cout << " seconds\n\tapply/test/retract - ";
+    printf("%6.3f", r.applied / CLOCKS_PER_SEC);
+    cout << " seconds\n\n";
+    Witchcraft::destroy();
+    return r.mismatches != 0;
+}
+
+/** Round trip counts and timings for charNotationBench. */
+struct NotationBench {
+    uint64_t moves = 0, mismatches = 0;
+    double toSan = 0, fromSan = 0, toUci = 0, fromUci = 0;
+};
+
+/**
+ * Walk the perft tree to the given depth and, at every
+ * node, write each move in SAN and UCI and read it back.
+ */
+void notationBench(Board* const b, const int depth, NotationBench& r) {
+    Move m[256];
+    const int n = MoveFactory::generateMoves<All>(b, m);
+    char san[256][Notation::MoveLength], uci[256][Notation::MoveLength];
+    bool ok[256];
+    clock_t start = clock();
+    for(int i = 0; i < n; ++i)
+        Notation::toSan(*b, m[i], san[i]);
+    r.toSan += clock() - start;
+    start = clock();
+    for(int i = 0; i < n; ++i)
+        ok[i] = Notation::fromSan(*b, san[i], strlen(san[i])) == m[i];
+    r.fromSan += clock() - start;
+    start = clock();
+    for(int i = 0; i < n; ++i)
+        Notation::toUci(m[i], uci[i]);
+    r.toUci += clock() - start;
+    start = clock();
+    for(int i = 0; i < n; ++i)
+        ok[i] &= Notation::fromUci(*b, uci[i]) == m[i];
+    r.fromUci += clock() - start;
+    for(int i = 0; i < n; ++i)
+        r.mismatches += !ok[i];
+    r.moves += n;
+    if(depth <= 1) return;
+    for(int i = 0; i < n; ++i) {
+        b->applyMove(m[i]);
+        notationBench(b, depth - 1, r);
+        b->retractMove(m[i]);
+    }
+}
+
+inline int charNotationBench(const int n, const int argc,
+                             const char** const argv) {
+    if(n <= 0) return displayUsage();
+    Witchcraft::init();
+    Board b = (argc == 3) ?
+              Board::Builder<Default>().build() :
+              FenUtility::parseBoard(argv[3]);
+    NotationBench r;
+    notationBench(&b, n, r);
+    const double moves = r.moves ? (double) r.moves : 1;
+    cout << "\n\tmoves converted - " << r.moves
+         << "\n\tmismatches      - " << r.mismatches << '\n';
+    printf("\ttoSan           - %6.3f seconds - %6.1f ns/move\n"
+           "\tfromSan         - %6.3f seconds - %6.1f ns/move\n"
+           "\ttoUci           - %6.3f seconds - %6.1f ns/move\n"
+           "\tfromUci         - %6.3f seconds - %6.1f ns/move\n\n",
+           r.toSan / CLOCKS_PER_SEC, 1e9 * r.toSan / CLOCKS_PER_SEC / moves,
+           r.fromSan / CLOCKS_PER_SEC, 1e9 * r.fromSan / CLOCKS_PER_SEC / moves,
+           r.toUci / CLOCKS_PER_SEC, 1e9 * r.toUci / CLOCKS_PER_SEC / moves,
+           r.fromUci / CLOCKS_PER_SEC, 1e9 * r.fromUci / CLOCKS_PER_SEC / moves);
+    Witchcraft::destroy();
+    return r.mismatches != 0;
+}
+
+/**
+ * Walk the perft tree to the given depth and pack every
+ * node, with its Zobrist key to check the unpacking against.
+ * Without a list of positions, only walk.
+ */
+void packTree(Board* const b, const int depth,
+              std::vector<Packed::Position>* const positions,
+              std::vector<uint64_t>* const keys) {
+    if(positions) {
+        positions->emplace_back();
+        Packed::encode(*b, positions->back());
+        keys->push_back(b->getKey());
+    }
+    if(depth <= 0) return;
+    Move m[256];
+    const int n = MoveFactory::generateMoves<All>(b, m);
+    for(int i = 0; i < n; ++i) {
+        b->applyMove(m[i]);
+        packTree(b, depth - 1, positions, keys);
+        b->retractMove(m[i]);
+    }
+}
+
+inline int charPackedBench(const int n, const int argc,
+                           const char** const argv) {
+    if(n <= 0 || argc < 4) return displayUsage();
+    Witchcraft::init();
+    Board b = (argc == 4) ?
+              Board::Builder<Default>().build() :
+              FenUtility::parseBoard(argv[4]);
+    using Clock = std::chrono::steady_clock;
+    const auto since = [](const Clock::time_point t)
+    { return std::chrono::duration<double>(Clock::now() - t).count(); };
+    std::vector<Packed::Position> positions;
+    std::vector<uint64_t> keys;
+    // Packing is timed net of the walk that finds the nodes.
+    Clock::time_point start = Clock::now();
+    packTree(&b, n, nullptr, nullptr);
+    const double walk = since(start);
+    start = Clock::now();
+    packTree(&b, n, &positions, &keys);
+    const double encode = std::max(since(start) - walk, 0.0);
+    start = Clock::now();
+    {
+        Packed::Writer w(argv[3]);
+        for(const Packed::Position& p : positions) w.write(p);
+        if(!w.isOpen() || !w.flush()) {
+            fprintf(stderr, "could not write %s\n", argv[3]);
+            Witchcraft::destroy();
+            return 1;
+        }
+    }
+    const double write = since(start);
+    const Packed::Reader r(argv[3]);
+    uint64_t mismatches = r.size() != positions.size();
+    start = Clock::now();
+    for(size_t i = 0; i < r.size(); ++i) {
+        Board::Builder<Fen> builder;
+        Packed::decode(r[i], builder);
+        mismatches += builder.build().getKey() != keys[i];
+    }
+    const double decode = since(start);
+    const double count = positions.empty() ? 1 : (double) positions.size();
+    cout << "\n\tpositions packed - " << positions.size()
+         << "\n\tbytes written    - " << r.size() * sizeof(Packed::Position)
+         << "\n\tmismatches       - " << mismatches << '\n';
+    printf("\tencode           - %6.3f seconds - %7.2f M positions/s\n"
+           "\twrite            - %6.3f seconds - %7.1f MB/s\n"
+           "\tdecode to Board  - %6.3f seconds - %7.2f M positions/s\n\n",
+           encode, encode > 0 ? count / encode / 1e6 : 0.0,
+           write, write > 0 ? count * sizeof(Packed::Position) / write / 1e6 : 0.0,
+           decode, decode > 0 ? count / decode / 1e6 : 0.0);
+    Witchcraft::destroy();
+    return mismatches != 0;
+}
+
+inline int charBookBench(const int n, const int argc,
+                         const char** const argv) {
+    if(n <= 0 || argc < 4) return displayUsage();
+    Witchcraft::init();
+    // The keys are checked first: a book probed with wrong
+    // keys finds nothing, or the moves of other positions.
+    if(!Polyglot::selfTest()) {
+        fprintf(stderr, "Polyglot key self-test failed\n");
+        Witchcraft::destroy();
+        return 1;
+    }
+    Board b = (argc == 4) ?
+              Board::Builder<Default>().build() :
+              FenUtility::parseBoard(argv[4]);
+    using Clock = std::chrono::steady_clock;
+    Clock::time_point start = Clock::now();
+    const Polyglot::Book book(argv[3]);
+    const double open =
+        std::chrono::duration<double>(Clock::now() - start).count();
+    if(!book.isOpen()) {
+        fprintf(stderr, "could not load %s\n", argv[3]);
+        Witchcraft::destroy();
+        return 1;
+    }
+    Move moves[Polyglot::Book::MaxMoves];
+    int weights[Polyglot::Book::MaxMoves];
+    int found = 0;
+    start = Clock::now();
+    for(int i = 0; i < n; ++i)
+        found = book.probe(b, moves, weights);
+    const double probe =
+        std::chrono::duration<double>(Clock::now() - start).count();
+    printf("\n\tkey self-test    - passed\n"
+           "\tkey              - %016lx\n"
+           "\tentries          - %zu\n"
+           "\topen             - %6.1f microseconds\n"
+           "\tprobe            - %6.2f microseconds\n\n",
+           Polyglot::key(b), book.size(), open * 1e6, probe * 1e6 / n);
+    for(int i = 0; i < found; ++i) {
+        char uci[Notation::MoveLength], san[Notation::MoveLength];
+        printf("\t%-6s %-8s weight %d\n", Notation::toUci(moves[i], uci),
+               Notation::toSan(b, moves[i], san), weights[i]);
+    }
+    cout << '\n';
+    Witchcraft::destroy();
+    return 0;
+}
+
+/** The perft driver and depth of a stream. */
+PerftDriver streamDriver = perft;
+int streamDepth = 1;
+
+/** The number of lines streamed. */
+std::atomic<uint64_t> streamLines(0);
+
+/**
+ * Count the leaves of one streamed FEN or EPD line to the
+ * stream depth, or answer "invalid" if the line does not hold
+ * a position.
+ */
+void streamLine(const char* const line, const size_t length,
+                std::string& out) {
+    // Only the FEN fields matter, and parseBoard wants them
+    // terminated.
+    char fen[256];
+    const size_t n = length < sizeof(fen) - 1 ? length : sizeof(fen) - 1;
+    memcpy(fen, line, n);
+    fen[n] = '\0';
+    streamLines.fetch_add(1, std::memory_order_relaxed);
+    if(!FenUtility::isLegal(fen)) {
+        out += "invalid\n";
+        return;
+    }
+    Board b = FenUtility::parseBoard(fen);
+    char count[24];
+    out.append(count, sprintf(count, "%lu\n", streamDriver(&b, streamDepth)));
+}
+
+inline int charStream(const PerftDriver driver, const int n,
+                      const int argc, const char** const argv) {
+    const int threads = argc > 3 ? atoi(argv[3]) :
+        (int) std::max(std::thread::hardware_concurrency(), 1U);
+    if(threads <= 0) return displayUsage();
+    const char* const path =
+        argc > 4 && strcmp(argv[4], "-") != 0 ? argv[4] : nullptr;
+    Witchcraft::init();
+    streamDriver = driver;
+    streamDepth  = n;
+    const auto start = std::chrono::steady_clock::now();
+    const bool ok = Stream::run(path, threads, streamLine, stdout);
+    const double seconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start
+    ).count();
+    // Results go to stdout, so the summary goes to stderr.
+    if(ok) fprintf(stderr, "%lu lines - %.3f seconds - %.0f lines/s\n",
+                   streamLines.load(), seconds,
+                   seconds > 0 ? streamLines.load() / seconds : 0.0);
+    else fprintf(stderr, "could not read %s\n", path);
+    Witchcraft::destroy();
+    return ok ? 0 : 1;
+}
+
+inline int charPgn(const int argc, const char** const argv) {
+    const int threads = atoi(argv[2]);
+    if(threads <= 0 || argc < 4) return displayUsage();
+    Witchcraft::init();
+    Pgn::Stats stats;
+    const auto start = std::chrono::steady_clock::now();
+    const bool ok = Pgn::replay(argv[3], threads, nullptr, stats);
+    const double seconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start
+    ).count();
+    Witchcraft::destroy();
+    if(!ok) {
+        fprintf(stderr, "could not read %s\n", argv[3]);
+        return 1;
+    }
+    const double s = seconds > 0 ? seconds : 1e-9;
+    printf("%lu games - %lu plies - %lu errors - %.3f seconds\n"
+           "%.0f games/s - %.0f plies/s\n",
+           stats.games, stats.plies, stats.errors, seconds,
+           stats.games / s, stats.plies / s);
+    return 0;
+}
+
 inline int displayUsage() {
-    cout << "Usage: ./cc0 [\"-p\"|\"-v\"] [depth] {FEN} {count} <number>\n\n"
+    cout << "Usage: ./cc0 [\"-p\"|\"-v\"]<driver> [depth] {FEN} {count} <number>\n"
+         << "       ./cc0 -c [depth] <FEN>\n"
+         << "       ./cc0 -n [depth] <FEN>\n"
+         << "       ./cc0 -d [depth] [file] <FEN>\n"
+         << "       ./cc0 -o [lookups] [book] <FEN>\n"
+         << "       ./cc0 -s<driver> [depth] <threads> <file>\n"
+         << "       ./cc0 -g [threads] [PGN]\n\n"
          << "Usage Symbols (do not pass these with args)\n"
          << "[] : required argument\n"
          << "\"\": literal\n"
@@ -111,8 +543,24 @@ inline int displayUsage() {
          << "Key\n"
          << "-p     : normal q-perft style perft mode\n"
          << "-v     : verification mode (for shell script use)\n"
+         << "-c     : givesCheck benchmark against apply/test/retract\n"
+         << "-s     : stream mode: perft each FEN or EPD line of the\n"
+         << "         file, or of stdin if there is none or it is \"-\",\n"
+         << "         and print the counts in input order\n"
+         << "-n     : SAN and UCI round trip benchmark\n"
+         << "-d     : pack every node of the perft tree into a file\n"
+         << "         of binary positions, read it back, and time both\n"
+         << "-g     : replay every game of a PGN file\n"
+         << "-o     : check the Polyglot keys against the examples of\n"
+         << "         the specification, then list the moves of a\n"
+         << "         Polyglot book and time the lookup\n"
+         << "threads: the number of stream or replay workers\n"
+         << "file   : a file of FEN or EPD lines\n"
+         << "driver : \"b\" to count leaves in SIMD board batches,\n"
+         << "         \"q\" to copy-make compact quad bitboards\n"
          << "depth  : the perft depth (a positive integer)\n"
          << "FEN    : a board in Forsyth-Edwards Notation\n"
+         << "PGN    : a file of games in Portable Game Notation\n"
          << "count  : the node count to verify\n"
          << "number : an integer to represent the line of the client script\n";
     return 0;
@@ -0,0 +1,275 @@
+#include "ChaosMagic.h"
+#include "Fen.h"
+#include "Search.h"
+#include "Notation.h"
+#include "SelfPlay.h"
+#include <cmath>
+#include <cstring>
+#include <iostream>
+
+using std::cout;
+using namespace Charon;
+
+int displayUsage();
+int bench(int, int, const char**);
+int selfPlay(int, const char**);
+void report(const Search::Iteration&);
+
+/** The node counts of each iteration, for the summary. */
+uint64_t iterationNodes[Search::MaxDepth];
+
+/** The pawn table lookups and hits of the last iteration. */
+uint64_t pawnProbes, pawnHits;
+
+/**
+ * The bench positions: middlegames and endgames from the
+ * perft suite in test.sh.
+ */
+const char* const BenchFens[] = {
+    "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - ",
+    "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - ",
+    "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - ",
+    "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - ",
+    "rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - ",
+    "r4rk1/1pp1qppp/p1np1n2/2b1p1B1/2B1P1b1/P1NP1N2/1PP1QPPP/R4RK1 w - - ",
+    "rnbqkb1r/pp1p1ppp/2p5/4P3/2B5/8/PPP1NnPP/RNBQK2R w KQkq - ",
+    "r3k2r/8/3Q4/8/8/5q2/8/R3K2R b KQkq - ",
+    "n1n5/PPPk4/8/8/8/8/4Kppp/5N1N w - - ",
+    "R6r/8/8/2K5/5k2/8/8/r6R w - - ",
+    "8/8/4k3/3Nn3/3nN3/4K3/8/8 w - - ",
+    "3k4/3pp3/8/8/8/8/3PP3/3K4 w - - ",
+    "8/2k1p3/3pP3/3P2K1/8/8/8/8 w - - ",
+    "8/8/1k6/8/2pP4/8/5BK1/8 b - d3 "
+};
+
+int main(const int argc, const char** const argv) {
+    if(argc < 2) return displayUsage();
+    if(!strcmp(argv[1], "-b"))
+        return argc > 2 ? bench(atoi(argv[2]), argc, argv) : displayUsage();
+    if(!strcmp(argv[1], "-g"))
+        return argc > 3 ? selfPlay(argc, argv) : displayUsage();
+    const int depth = atoi(argv[1]);
+    if(depth <= 0 || depth >= Search::MaxDepth) return displayUsage();
+    const int megabytes = argc > 3 ? atoi(argv[3]) : 64;
+    if(megabytes <= 0) return displayUsage();
+    const int threads = argc > 4 ? atoi(argv[4]) : 1;
+    if(threads <= 0 || threads > Search::MaxThreads) return displayUsage();
+    Witchcraft::init();
+    if(argc > 5 && !Nnue::load(argv[5])) {
+        cout << "Could not load the network " << argv[5] << '\n';
+        return displayUsage();
+    }
+    if(argc > 2 && !FenUtility::isLegal(argv[2])) {
+        cout << "Invalid FEN " << argv[2] << "\n\n";
+        Nnue::unload();
+        Witchcraft::destroy();
+        return displayUsage();
+    }
+    Board b = (argc == 2) ?
+              Board::Builder<Default>().build() :
+              FenUtility::parseBoard(argv[2]);
+    TranspositionTable tt(megabytes);
+    Search::Limits limits;
+    limits.depth   = depth;
+    limits.threads = threads;
+    cout << "\n\t.~* Charon Search *~.\n" << b << '\n';
+    printf("\tdepth  score        nodes     seconds        nps    ebf    fhf  pv\n");
+    std::atomic<bool> stop(false);
+    const Move best = Search::think(b, tt, limits, report, stop);
+    char buffer[6];
+    // The effective branching factor over the whole run is
+    // the geometric mean of the per-iteration ratios.
+    double ebf = 0;
+    if(depth > 1 && iterationNodes[1] > 0 && iterationNodes[depth] > 0)
+        ebf = pow((double) iterationNodes[depth] / iterationNodes[1],
+                  1.0 / (depth - 1));
+    printf("\n\tbest move %s - mean ebf %.2f - pawn hits %.1f%%\n\n",
+           Notation::toUci(best, buffer), ebf,
+           pawnProbes ? 100.0 * pawnHits / pawnProbes : 0.0);
+    Nnue::unload();
+    Witchcraft::destroy();
+    return 0;
+}
+
+/**
+ * A function to search each bench position to a fixed depth
+ * with a fresh table, and to total the nodes and time. The
+ * heuristics to turn on are given as letters: n for null-move
+ * pruning, l for late move reductions, r for reverse futility
+ * pruning, f for futility pruning and e for check extensions.
+ * Any other text turns them all off; none turns them all on.
+ * With a node limit, each search ends at that many nodes or
+ * the depth, whichever comes first, and the totals of one
+ * thread are the same on every run. With more threads, the
+ * time to reach the depth measures the Lazy SMP speedup.
+ *
+ * @param depth the depth to search each position to
+ * @param argc  the number of arguments
+ * @param argv  the arguments
+ * @return the exit status
+ */
+int bench(const int depth, const int argc, const char** const argv) {
+    if(depth <= 0 || depth >= Search::MaxDepth) return displayUsage();
+    Search::Limits limits;
+    limits.depth = depth;
+    if(argc > 4) limits.nodes = strtoull(argv[4], nullptr, 10);
+    if(argc > 5) limits.threads = atoi(argv[5]);
+    if(limits.threads <= 0 || limits.threads > Search::MaxThreads)
+        return displayUsage();
+    if(argc > 3) {
+        limits.heuristics = 0;
+        for(const char* c = argv[3]; *c; ++c)
+            limits.heuristics |=
+                *c == 'n' ? Search::NullMovePruning :
+                *c == 'l' ? Search::LateMoveReductions :
+                *c == 'r' ? Search::ReverseFutility :
+                *c == 'f' ? Search::FutilityPruning :
+                *c == 'e' ? Search::CheckExtensions : 0;
+    }
+    Witchcraft::init();
+    TranspositionTable tt(64);
+    std::atomic<bool> stop(false);
+    const int n = sizeof(BenchFens) / sizeof(BenchFens[0]);
+    cout << "\n\t.~* Charon Search Bench *~.\n\n";
+    printf("\tdepth %d, nodes %lu, threads %d, heuristics %c%c%c%c%c\n\n",
+           depth, limits.nodes, limits.threads,
+           limits.heuristics & Search::NullMovePruning    ? 'n' : '-',
+           limits.heuristics & Search::LateMoveReductions ? 'l' : '-',
+           limits.heuristics & Search::ReverseFutility    ? 'r' : '-',
+           limits.heuristics & Search::FutilityPruning    ? 'f' : '-',
+           limits.heuristics & Search::CheckExtensions    ? 'e' : '-');
+    printf("\t  #         nodes     seconds  best   pawn hits\n");
+    uint64_t totalNodes = 0, totalProbes = 0, totalHits = 0;
+    double totalSeconds = 0;
+    for(int i = 0; i < n; ++i) {
+        Board b = FenUtility::parseBoard(BenchFens[i]);
+        tt.clear();
+        stop.store(false);
+        iterationNodes[0] = pawnProbes = pawnHits = 0;
+        const auto start = std::chrono::steady_clock::now();
+        const Move best = Search::think(b, tt, limits, [](
+            const Search::Iteration& it
+        ) {
+            iterationNodes[0] = it.totalNodes;
+            pawnProbes = it.pawnProbes;
+            pawnHits   = it.pawnHits;
+        }, stop);
+        const double seconds = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - start
+        ).count();
+        char buffer[6];
+        printf("\t%3d %13lu %11.3f  %-6s %8.1f%%\n", i + 1,
+               iterationNodes[0], seconds,
+               Notation::toUci(best, buffer),
+               pawnProbes ? 100.0 * pawnHits / pawnProbes : 0.0);
+        totalNodes   += iterationNodes[0];
+        totalProbes  += pawnProbes;
+        totalHits    += pawnHits;
+        totalSeconds += seconds;
+    }
+    printf("\n\ttotal %9lu %11.3f  %.0f nps, pawn hits %.1f%%\n\n",
+           totalNodes, totalSeconds,
+           totalSeconds > 0 ? totalNodes / totalSeconds : 0.0,
+           totalProbes ? 100.0 * totalHits / totalProbes : 0.0);
+    Witchcraft::destroy();
+    return 0;
+}
+
+void report(const Search::Iteration& it) {
+    iterationNodes[it.depth] = it.nodes;
+    pawnProbes = it.pawnProbes;
+    pawnHits   = it.pawnHits;
+    const double ebf = it.depth > 1 && iterationNodes[it.depth - 1] ?
+        (double) it.nodes / iterationNodes[it.depth - 1] : 0;
+    // The share of cutoffs made by the first move tried
+    // measures how well the moves are ordered.
+    const double fhf = it.failHighs ?
+        100.0 * it.failHighFirsts / it.failHighs : 0;
+    printf("\t%5d %6d %12lu %11.3f %10.0f %6.2f %5.1f%% ",
+           it.depth, it.score, it.totalNodes, it.seconds,
+           it.seconds > 0 ? it.totalNodes / it.seconds : 0.0, ebf, fhf);
+    char buffer[6];
+    for(int i = 0; i < it.pvLength; ++i)
+        printf(" %s", Notation::toUci(it.pv[i], buffer));
+    printf("\n");
+}
+
+/**
+ * A function to generate self-play positions into shard
+ * files and to report the rate. The arguments after the
+ * number of games and the output prefix are the search depth
+ * (zero for random play), the threads, the seed, the shards
+ * and a file of opening positions.
+ *
+ * @param argc the number of arguments
+ * @param argv the arguments
+ * @return the exit status
+ */
+int selfPlay(const int argc, const char** const argv) {
+    SelfPlay::Options o;
+    o.games  = strtoull(argv[2], nullptr, 10);
+    o.output = argv[3];
+    if(argc > 4) o.depth   = atoi(argv[4]);
+    if(argc > 5) o.threads = atoi(argv[5]);
+    if(argc > 6) o.seed    = strtoull(argv[6], nullptr, 10);
+    if(argc > 7) o.shards  = atoi(argv[7]);
+    if(argc > 8) o.openings = argv[8];
+    if(o.games == 0 || o.depth < 0 || o.depth >= Search::MaxDepth ||
+       o.threads <= 0 || o.shards <= 0)
+        return displayUsage();
+    Witchcraft::init();
+    SelfPlay::Stats stats;
+    const auto start = std::chrono::steady_clock::now();
+    const bool ok = SelfPlay::generate(o, stats);
+    const double seconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start
+    ).count();
+    Witchcraft::destroy();
+    const double s = seconds > 0 ? seconds : 1e-9;
+    printf("\n\t.~* Charon Self-Play *~.\n\n"
+           "\tdepth %d, threads %d, seed %lu, shards %d\n\n"
+           "\tgames       %12lu  (+%lu =%lu -%lu)\n"
+           "\tplies       %12lu\n"
+           "\tpositions   %12lu\n"
+           "\tseconds     %12.3f\n"
+           "\tgames/s     %12.1f\n"
+           "\tplies/s     %12.0f\n"
+           "\tpositions/s %12.0f\n\n",
+           o.depth, o.threads, o.seed, o.shards,
+           stats.games, stats.whiteWins, stats.draws, stats.blackWins,
+           stats.plies, stats.positions, seconds,
+           stats.games / s, stats.plies / s, stats.positions / s);
+    if(!ok) cout << "\tcould not read the openings or write a shard\n\n";
+    return ok ? 0 : 1;
+}
+
+int displayUsage() {
+    cout << "Usage: ./cs0 [depth] <FEN> <hash> <threads> <net>\n"
+         << "       ./cs0 -b [depth] <heuristics> <nodes> <threads>\n"
+         << "       ./cs0 -g [games] [prefix] <depth> <threads> <seed> <shards> <openings>\n\n"
+         << "Usage Symbols (do not pass these with args)\n"
+         << "[] : required argument\n"
+         << "<> : optional argument\n\n"
+         << "Key\n"
+         << "depth   : the search depth (a positive integer)\n"
+         << "FEN     : a board in Forsyth-Edwards Notation\n"
+         << "hash    : the transposition table size in megabytes\n"
+         << "threads : the number of search threads\n"
+         << "net     : a network file to evaluate with\n"
+         << "-b      : search the bench positions to the depth\n"
+         << "heuristics : the heuristics to turn on, any of\n"
+         << "             n (null move), l (late move reductions),\n"
+         << "             r (reverse futility), f (futility) and\n"
+         << "             e (check extensions); - for none\n"
+         << "nodes   : the most nodes to search each position for,\n"
+         << "          or 0 for no limit\n"
+         << "threads : with -b, the number of search threads\n"
+         << "-g      : play games against itself and write a sample of\n"
+         << "          their positions to prefix-000.bin and on\n"
+         << "depth   : with -g, the search depth of each move, or 0\n"
+         << "          for random moves\n"
+         << "seed    : the seed of the games\n"
+         << "shards  : the number of output files\n"
+         << "openings: a file of FEN or EPD lines to start from\n";
+    return 0;
+}
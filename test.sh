@@ -1,162 +1,163 @@
-./cc0 -v 6 "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - " 119060324 1
-./cc0 -v 5 "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - " 193690690 2
-./cc0 -v 6 "4k3/8/8/8/8/8/8/4K2R w K - " 764643 3
-./cc0 -v 6 "4k3/8/8/8/8/8/8/R3K3 w Q - " 846648 4
-./cc0 -v 6 "4k2r/8/8/8/8/8/8/4K3 w k - " 899442 5
-./cc0 -v 6 "r3k3/8/8/8/8/8/8/4K3 w q - " 1001523 6
-./cc0 -v 6 "4k3/8/8/8/8/8/8/R3K2R w KQ - " 2788982 7
-./cc0 -v 6 "r3k2r/8/8/8/8/8/8/4K3 w kq - " 3517770 8
-./cc0 -v 6 "8/8/8/8/8/8/6k1/4K2R w K - " 185867 9
-./cc0 -v 6 "8/8/8/8/8/8/1k6/R3K3 w Q - " 413018 10
-./cc0 -v 6 "4k2r/6K1/8/8/8/8/8/8 w k - " 179869 11
-./cc0 -v 6 "r3k3/1K6/8/8/8/8/8/8 w q - " 367724 12
-./cc0 -v 6 "r3k2r/8/8/8/8/8/8/R3K2R w KQkq - " 179862938 13
-./cc0 -v 6 "r3k2r/8/8/8/8/8/8/1R2K2R w Kkq - " 195629489 14
-./cc0 -v 6 "r3k2r/8/8/8/8/8/8/2R1K2R w Kkq - " 184411439 15
-./cc0 -v 6 "r3k2r/8/8/8/8/8/8/R3K1R1 w Qkq - " 189224276 16
-./cc0 -v 6 "1r2k2r/8/8/8/8/8/8/R3K2R w KQk - " 198328929 17
-./cc0 -v 6 "2r1k2r/8/8/8/8/8/8/R3K2R w KQk - " 185959088 18
-./cc0 -v 6 "r3k1r1/8/8/8/8/8/8/R3K2R w KQq - " 190755813 19
-./cc0 -v 6 "4k3/8/8/8/8/8/8/4K2R b K - " 899442 20
-./cc0 -v 6 "4k3/8/8/8/8/8/8/R3K3 b Q - " 1001523 21
-./cc0 -v 6 "4k2r/8/8/8/8/8/8/4K3 b k - " 764643 22
-./cc0 -v 6 "r3k3/8/8/8/8/8/8/4K3 b q - " 846648 23
-./cc0 -v 6 "4k3/8/8/8/8/8/8/R3K2R b KQ - " 3517770 24
-./cc0 -v 6 "r3k2r/8/8/8/8/8/8/4K3 b kq - " 2788982 25
-./cc0 -v 6 "8/8/8/8/8/8/6k1/4K2R b K - " 179869 26
-./cc0 -v 6 "8/8/8/8/8/8/1k6/R3K3 b Q - " 367724 27
-./cc0 -v 6 "4k2r/6K1/8/8/8/8/8/8 b k - " 185867 28
-./cc0 -v 6 "r3k3/1K6/8/8/8/8/8/8 b q - " 413018 29
-./cc0 -v 6 "r3k2r/8/8/8/8/8/8/R3K2R b KQkq - " 179862938 30
-./cc0 -v 6 "r3k2r/8/8/8/8/8/8/1R2K2R b Kkq - " 198328929 31
-./cc0 -v 6 "r3k2r/8/8/8/8/8/8/2R1K2R b Kkq - " 185959088 32
-./cc0 -v 6 "r3k2r/8/8/8/8/8/8/R3K1R1 b Qkq - " 190755813 33
-./cc0 -v 6 "1r2k2r/8/8/8/8/8/8/R3K2R b KQk - " 195629489 34
-./cc0 -v 6 "2r1k2r/8/8/8/8/8/8/R3K2R b KQk - " 184411439 35
-./cc0 -v 6 "r3k1r1/8/8/8/8/8/8/R3K2R b KQq - " 189224276 36
-./cc0 -v 6 "8/1n4N1/2k5/8/8/5K2/1N4n1/8 w - - " 8107539 37
-./cc0 -v 6 "8/1k6/8/5N2/8/4n3/8/2K5 w - - " 2594412 38
-./cc0 -v 6 "8/8/4k3/3Nn3/3nN3/4K3/8/8 w - - " 19870403 39
-./cc0 -v 6 "K7/8/2n5/1n6/8/8/8/k6N w - - " 588695 40
-./cc0 -v 6 "k7/8/2N5/1N6/8/8/8/K6n w - - " 688780 41
-./cc0 -v 6 "8/1n4N1/2k5/8/8/5K2/1N4n1/8 b - - " 8503277 42
-./cc0 -v 6 "8/1k6/8/5N2/8/4n3/8/2K5 b - - " 3147566 43
-./cc0 -v 6 "8/8/3K4/3Nn3/3nN3/4k3/8/8 b - - " 4405103 44
-./cc0 -v 6 "K7/8/2n5/1n6/8/8/8/k6N b - - " 688780 45
-./cc0 -v 6 "k7/8/2N5/1N6/8/8/8/K6n b - - " 588695 46
-./cc0 -v 6 "B6b/8/8/8/2K5/4k3/8/b6B w - - " 22823890 47
-./cc0 -v 6 "8/8/1B6/7b/7k/8/2B1b3/7K w - - " 28861171 48
-./cc0 -v 6 "k7/B7/1B6/1B6/8/8/8/K6b w - - " 7881673 49
-./cc0 -v 6 "K7/b7/1b6/1b6/8/8/8/k6B w - - " 7382896 50
-./cc0 -v 6 "B6b/8/8/8/2K5/5k2/8/b6B b - - " 9250746 51
-./cc0 -v 6 "8/8/1B6/7b/7k/8/2B1b3/7K b - - " 29027891 52
-./cc0 -v 6 "k7/B7/1B6/1B6/8/8/8/K6b b - - " 7382896 53
-./cc0 -v 6 "K7/b7/1b6/1b6/8/8/8/k6B b - - " 7881673 54
-./cc0 -v 6 "7k/RR6/8/8/8/8/rr6/7K w - - " 44956585 55
-./cc0 -v 6 "R6r/8/8/2K5/5k2/8/8/r6R w - - " 525169084 56
-./cc0 -v 6 "7k/RR6/8/8/8/8/rr6/7K b - - " 44956585 57
-./cc0 -v 6 "R6r/8/8/2K5/5k2/8/8/r6R b - - " 524966748 58
-./cc0 -v 6 "6kq/8/8/8/8/8/8/7K w - - " 391507 59
-./cc0 -v 6 "6KQ/8/8/8/8/8/8/7k b - - " 391507 60
-./cc0 -v 6 "K7/8/8/3Q4/4q3/8/8/7k w - - " 3370175 61
-./cc0 -v 6 "6qk/8/8/8/8/8/8/7K b - - " 419369 62
-./cc0 -v 6 "6KQ/8/8/8/8/8/8/7k b - - " 391507 63
-./cc0 -v 6 "K7/8/8/3Q4/4q3/8/8/7k b - - " 3370175 64
-./cc0 -v 6 "8/8/8/8/8/K7/P7/k7 w - - " 6249 65
-./cc0 -v 6 "8/8/8/8/8/7K/7P/7k w - - " 6249 66
-./cc0 -v 6 "K7/p7/k7/8/8/8/8/8 w - - " 2343 67
-./cc0 -v 6 "7K/7p/7k/8/8/8/8/8 w - - " 2343 68
-./cc0 -v 6 "8/2k1p3/3pP3/3P2K1/8/8/8/8 w - - " 34834 69
-./cc0 -v 6 "8/8/8/8/8/K7/P7/k7 b - - " 2343 70
-./cc0 -v 6 "8/8/8/8/8/7K/7P/7k b - - " 2343 71
-./cc0 -v 6 "K7/p7/k7/8/8/8/8/8 b - - " 6249 72
-./cc0 -v 6 "7K/7p/7k/8/8/8/8/8 b - - " 6249 73
-./cc0 -v 6 "8/2k1p3/3pP3/3P2K1/8/8/8/8 b - - " 34822 74
-./cc0 -v 6 "8/8/8/8/8/4k3/4P3/4K3 w - - " 11848 75
-./cc0 -v 6 "4k3/4p3/4K3/8/8/8/8/8 b - - " 11848 76
-./cc0 -v 6 "8/8/7k/7p/7P/7K/8/8 w - - " 10724 77
-./cc0 -v 6 "8/8/k7/p7/P7/K7/8/8 w - - " 10724 78
-./cc0 -v 6 "8/8/3k4/3p4/3P4/3K4/8/8 w - - " 53138 79
-./cc0 -v 6 "8/3k4/3p4/8/3P4/3K4/8/8 w - - " 157093 80
-./cc0 -v 6 "8/8/3k4/3p4/8/3P4/3K4/8 w - - " 158065 81
-./cc0 -v 6 "k7/8/3p4/8/3P4/8/8/7K w - - " 20960 82
-./cc0 -v 6 "8/8/7k/7p/7P/7K/8/8 b - - " 10724 83
-./cc0 -v 6 "8/8/k7/p7/P7/K7/8/8 b - - " 10724 84
-./cc0 -v 6 "8/8/3k4/3p4/3P4/3K4/8/8 b - - " 53138 85
-./cc0 -v 6 "8/3k4/3p4/8/3P4/3K4/8/8 b - - " 158065 86
-./cc0 -v 6 "8/8/3k4/3p4/8/3P4/3K4/8 b - - " 157093 87
-./cc0 -v 6 "k7/8/3p4/8/3P4/8/8/7K b - - " 21104 88
-./cc0 -v 6 "7k/3p4/8/8/3P4/8/8/K7 w - - " 32191 89
-./cc0 -v 6 "7k/8/8/3p4/8/8/3P4/K7 w - - " 30980 90
-./cc0 -v 6 "k7/8/8/7p/6P1/8/8/K7 w - - " 41874 91
-./cc0 -v 6 "k7/8/7p/8/8/6P1/8/K7 w - - " 29679 92
-./cc0 -v 6 "k7/8/8/6p1/7P/8/8/K7 w - - " 41874 93
-./cc0 -v 6 "k7/8/6p1/8/8/7P/8/K7 w - - " 29679 94
-./cc0 -v 6 "k7/8/8/3p4/4p3/8/8/7K w - - " 22886 95
-./cc0 -v 6 "k7/8/3p4/8/8/4P3/8/7K w - - " 28662 96
-./cc0 -v 6 "7k/3p4/8/8/3P4/8/8/K7 b - - " 32167 97
-./cc0 -v 6 "7k/8/8/3p4/8/8/3P4/K7 b - - " 30749 98
-./cc0 -v 6 "k7/8/8/7p/6P1/8/8/K7 b - - " 41874 99
-./cc0 -v 6 "k7/8/7p/8/8/6P1/8/K7 b - - " 29679 100
-./cc0 -v 6 "k7/8/8/6p1/7P/8/8/K7 b - - " 41874 101
-./cc0 -v 6 "k7/8/6p1/8/8/7P/8/K7 b - - " 29679 102
-./cc0 -v 6 "k7/8/8/3p4/4p3/8/8/7K b - - " 22579 103
-./cc0 -v 6 "k7/8/3p4/8/8/4P3/8/7K b - - " 28662 104
-./cc0 -v 6 "7k/8/8/p7/1P6/8/8/7K w - - " 41874 105
-./cc0 -v 6 "7k/8/p7/8/8/1P6/8/7K w - - " 29679 106
-./cc0 -v 6 "7k/8/8/1p6/P7/8/8/7K w - - " 41874 107
-./cc0 -v 6 "7k/8/1p6/8/8/P7/8/7K w - - " 29679 108
-./cc0 -v 6 "k7/7p/8/8/8/8/6P1/K7 w - - " 55338 109
-./cc0 -v 6 "k7/6p1/8/8/8/8/7P/K7 w - - " 55338 110
-./cc0 -v 6 "3k4/3pp3/8/8/8/8/3PP3/3K4 w - - " 199002 111
-./cc0 -v 6 "7k/8/8/p7/1P6/8/8/7K b - - " 41874 112
-./cc0 -v 6 "7k/8/p7/8/8/1P6/8/7K b - - " 29679 113
-./cc0 -v 6 "7k/8/8/1p6/P7/8/8/7K b - - " 41874 114
-./cc0 -v 6 "7k/8/1p6/8/8/P7/8/7K b - - " 29679 115
-./cc0 -v 6 "k7/7p/8/8/8/8/6P1/K7 b - - " 55338 116
-./cc0 -v 6 "k7/6p1/8/8/8/8/7P/K7 b - - " 55338 117
-./cc0 -v 6 "3k4/3pp3/8/8/8/8/3PP3/3K4 b - - " 199002 118
-./cc0 -v 6 "8/Pk6/8/8/8/8/6Kp/8 w - - " 1030499 119
-./cc0 -v 6 "n1n5/1Pk5/8/8/8/8/5Kp1/5N1N w - - " 37665329 120
-./cc0 -v 6 "8/PPPk4/8/8/8/8/4Kppp/8 w - - " 28859283 121
-./cc0 -v 6 "n1n5/PPPk4/8/8/8/8/4Kppp/5N1N w - - " 71179139 122
-./cc0 -v 6 "8/Pk6/8/8/8/8/6Kp/8 b - - " 1030499 123
-./cc0 -v 6 "n1n5/1Pk5/8/8/8/8/5Kp1/5N1N b - - " 37665329 124
-./cc0 -v 6 "8/PPPk4/8/8/8/8/4Kppp/8 b - - " 28859283 125
-./cc0 -v 6 "n1n5/PPPk4/8/8/8/8/4Kppp/5N1N b - - " 71179139 126
-./cc0 -v 6 "8/8/1k6/8/2pP4/8/5BK1/8 b - d3 " 824064 127
-./cc0 -v 6 "8/8/1k6/2b5/2pP4/8/5K2/8 b - d3 " 1440467 128
-./cc0 -v 6 "8/5k2/8/2Pp4/2B5/1K6/8/8 w - d6 " 1440467 129
-./cc0 -v 6 "5k2/8/8/8/8/8/8/4K2R w K - " 661072 130
-./cc0 -v 6 "4k2r/8/8/8/8/8/8/5K2 b k - " 661072 131
-./cc0 -v 6 "3k4/8/8/8/8/8/8/R3K3 w Q - " 803711 132
-./cc0 -v 6 "r3k3/8/8/8/8/8/8/3K4 b q - " 803711 133
-./cc0 -v 4 "r3k2r/1b4bq/8/8/8/8/7B/R3K2R w KQkq - " 1274206 134
-./cc0 -v 4 "r3k2r/7b/8/8/8/8/1B4BQ/R3K2R b KQkq - " 1274206 135
-./cc0 -v 4 "r3k2r/8/3Q4/8/8/5q2/8/R3K2R b KQkq - " 1720476 136
-./cc0 -v 4 "r3k2r/8/5Q2/8/8/3q4/8/R3K2R w KQkq - " 1720476 137
-./cc0 -v 6 "2K2r2/4P3/8/8/8/8/8/3k4 w - - " 3821001 138
-./cc0 -v 6 "3K4/8/8/8/8/8/4p3/2k2R2 b - - " 3821001 139
-./cc0 -v 5 "8/8/1P2K3/8/2n5/1q6/8/5k2 b - - " 1004658 140
-./cc0 -v 5 "5K2/8/1Q6/2N5/8/1p2k3/8/8 w - - " 1004658 141
-./cc0 -v 6 "4k3/1P6/8/8/8/8/K7/8 w - - " 217342 142
-./cc0 -v 6 "8/k7/8/8/8/8/1p6/4K3 b - - " 217342 143
-./cc0 -v 6 "8/P1k5/K7/8/8/8/8/8 w - - " 92683 144
-./cc0 -v 6 "8/8/8/8/8/k7/p1K5/8 b - - " 92683 145
-./cc0 -v 6 "K1k5/8/P7/8/8/8/8/8 w - - " 2217 146
-./cc0 -v 6 "8/8/8/8/8/p7/8/k1K5 b - - " 2217 147
-./cc0 -v 7 "8/k1P5/8/1K6/8/8/8/8 w - - " 567584 148
-./cc0 -v 7 "8/8/8/8/1k6/8/K1p5/8 b - - " 567584 149
-./cc0 -v 4 "8/8/2k5/5q2/5n2/8/5K2/8 b - - " 23527 150
-./cc0 -v 4 "8/5k2/8/5N2/5Q2/2K5/8/8 w - - " 23527 151
-./cc0 -v 5 "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - " 193690690 152
-./cc0 -v 6 "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - " 11030083 153
-./cc0 -v 5 "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - " 15833292 154
-./cc0 -v 3 "rnbqkb1r/pp1p1ppp/2p5/4P3/2B5/8/PPP1NnPP/RNBQK2R w KQkq - " 53392 155
-./cc0 -v 5 "r4rk1/1pp1qppp/p1np1n2/2b1p1B1/2B1P1b1/P1NP1N2/1PP1QPPP/R4RK1 w - - " 164075551 156
-./cc0 -v 7 "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - " 178633661 157
-./cc0 -v 6 "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - " 706045033 158
-./cc0 -v 5 "rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - " 89941194 159
-./cc0 -v 5 "1k6/1b6/8/8/7R/8/8/4K2R b K - " 1063513 160
-./cc0 -v 6 "3k4/3p4/8/K1P4r/8/8/8/8 b - - " 1134888 161
-./cc0 -v 6 "8/8/4k3/8/2p5/8/B2P2K1/8 w - - " 1015133 162
\ No newline at end of file
+MODE=${1:--v}
+./cc0 $MODE 6 "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - " 119060324 1
+./cc0 $MODE 5 "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - " 193690690 2
+./cc0 $MODE 6 "4k3/8/8/8/8/8/8/4K2R w K - " 764643 3
+./cc0 $MODE 6 "4k3/8/8/8/8/8/8/R3K3 w Q - " 846648 4
+./cc0 $MODE 6 "4k2r/8/8/8/8/8/8/4K3 w k - " 899442 5
+./cc0 $MODE 6 "r3k3/8/8/8/8/8/8/4K3 w q - " 1001523 6
+./cc0 $MODE 6 "4k3/8/8/8/8/8/8/R3K2R w KQ - " 2788982 7
+./cc0 $MODE 6 "r3k2r/8/8/8/8/8/8/4K3 w kq - " 3517770 8
+./cc0 $MODE 6 "8/8/8/8/8/8/6k1/4K2R w K - " 185867 9
+./cc0 $MODE 6 "8/8/8/8/8/8/1k6/R3K3 w Q - " 413018 10
+./cc0 $MODE 6 "4k2r/6K1/8/8/8/8/8/8 w k - " 179869 11
+./cc0 $MODE 6 "r3k3/1K6/8/8/8/8/8/8 w q - " 367724 12
+./cc0 $MODE 6 "r3k2r/8/8/8/8/8/8/R3K2R w KQkq - " 179862938 13
+./cc0 $MODE 6 "r3k2r/8/8/8/8/8/8/1R2K2R w Kkq - " 195629489 14
+./cc0 $MODE 6 "r3k2r/8/8/8/8/8/8/2R1K2R w Kkq - " 184411439 15
+./cc0 $MODE 6 "r3k2r/8/8/8/8/8/8/R3K1R1 w Qkq - " 189224276 16
+./cc0 $MODE 6 "1r2k2r/8/8/8/8/8/8/R3K2R w KQk - " 198328929 17
+./cc0 $MODE 6 "2r1k2r/8/8/8/8/8/8/R3K2R w KQk - " 185959088 18
+./cc0 $MODE 6 "r3k1r1/8/8/8/8/8/8/R3K2R w KQq - " 190755813 19
+./cc0 $MODE 6 "4k3/8/8/8/8/8/8/4K2R b K - " 899442 20
+./cc0 $MODE 6 "4k3/8/8/8/8/8/8/R3K3 b Q - " 1001523 21
+./cc0 $MODE 6 "4k2r/8/8/8/8/8/8/4K3 b k - " 764643 22
+./cc0 $MODE 6 "r3k3/8/8/8/8/8/8/4K3 b q - " 846648 23
+./cc0 $MODE 6 "4k3/8/8/8/8/8/8/R3K2R b KQ - " 3517770 24
+./cc0 $MODE 6 "r3k2r/8/8/8/8/8/8/4K3 b kq - " 2788982 25
+./cc0 $MODE 6 "8/8/8/8/8/8/6k1/4K2R b K - " 179869 26
+./cc0 $MODE 6 "8/8/8/8/8/8/1k6/R3K3 b Q - " 367724 27
+./cc0 $MODE 6 "4k2r/6K1/8/8/8/8/8/8 b k - " 185867 28
+./cc0 $MODE 6 "r3k3/1K6/8/8/8/8/8/8 b q - " 413018 29
+./cc0 $MODE 6 "r3k2r/8/8/8/8/8/8/R3K2R b KQkq - " 179862938 30
+./cc0 $MODE 6 "r3k2r/8/8/8/8/8/8/1R2K2R b Kkq - " 198328929 31
+./cc0 $MODE 6 "r3k2r/8/8/8/8/8/8/2R1K2R b Kkq - " 185959088 32
+./cc0 $MODE 6 "r3k2r/8/8/8/8/8/8/R3K1R1 b Qkq - " 190755813 33
+./cc0 $MODE 6 "1r2k2r/8/8/8/8/8/8/R3K2R b KQk - " 195629489 34
+./cc0 $MODE 6 "2r1k2r/8/8/8/8/8/8/R3K2R b KQk - " 184411439 35
+./cc0 $MODE 6 "r3k1r1/8/8/8/8/8/8/R3K2R b KQq - " 189224276 36
+./cc0 $MODE 6 "8/1n4N1/2k5/8/8/5K2/1N4n1/8 w - - " 8107539 37
+./cc0 $MODE 6 "8/1k6/8/5N2/8/4n3/8/2K5 w - - " 2594412 38
+./cc0 $MODE 6 "8/8/4k3/3Nn3/3nN3/4K3/8/8 w - - " 19870403 39
+./cc0 $MODE 6 "K7/8/2n5/1n6/8/8/8/k6N w - - " 588695 40
+./cc0 $MODE 6 "k7/8/2N5/1N6/8/8/8/K6n w - - " 688780 41
+./cc0 $MODE 6 "8/1n4N1/2k5/8/8/5K2/1N4n1/8 b - - " 8503277 42
+./cc0 $MODE 6 "8/1k6/8/5N2/8/4n3/8/2K5 b - - " 3147566 43
+./cc0 $MODE 6 "8/8/3K4/3Nn3/3nN3/4k3/8/8 b - - " 4405103 44
+./cc0 $MODE 6 "K7/8/2n5/1n6/8/8/8/k6N b - - " 688780 45
+./cc0 $MODE 6 "k7/8/2N5/1N6/8/8/8/K6n b - - " 588695 46
+./cc0 $MODE 6 "B6b/8/8/8/2K5/4k3/8/b6B w - - " 22823890 47
+./cc0 $MODE 6 "8/8/1B6/7b/7k/8/2B1b3/7K w - - " 28861171 48
+./cc0 $MODE 6 "k7/B7/1B6/1B6/8/8/8/K6b w - - " 7881673 49
+./cc0 $MODE 6 "K7/b7/1b6/1b6/8/8/8/k6B w - - " 7382896 50
+./cc0 $MODE 6 "B6b/8/8/8/2K5/5k2/8/b6B b - - " 9250746 51
+./cc0 $MODE 6 "8/8/1B6/7b/7k/8/2B1b3/7K b - - " 29027891 52
+./cc0 $MODE 6 "k7/B7/1B6/1B6/8/8/8/K6b b - - " 7382896 53
+./cc0 $MODE 6 "K7/b7/1b6/1b6/8/8/8/k6B b - - " 7881673 54
+./cc0 $MODE 6 "7k/RR6/8/8/8/8/rr6/7K w - - " 44956585 55
+./cc0 $MODE 6 "R6r/8/8/2K5/5k2/8/8/r6R w - - " 525169084 56
+./cc0 $MODE 6 "7k/RR6/8/8/8/8/rr6/7K b - - " 44956585 57
+./cc0 $MODE 6 "R6r/8/8/2K5/5k2/8/8/r6R b - - " 524966748 58
+./cc0 $MODE 6 "6kq/8/8/8/8/8/8/7K w - - " 391507 59
+./cc0 $MODE 6 "6KQ/8/8/8/8/8/8/7k b - - " 391507 60
+./cc0 $MODE 6 "K7/8/8/3Q4/4q3/8/8/7k w - - " 3370175 61
+./cc0 $MODE 6 "6qk/8/8/8/8/8/8/7K b - - " 419369 62
+./cc0 $MODE 6 "6KQ/8/8/8/8/8/8/7k b - - " 391507 63
+./cc0 $MODE 6 "K7/8/8/3Q4/4q3/8/8/7k b - - " 3370175 64
+./cc0 $MODE 6 "8/8/8/8/8/K7/P7/k7 w - - " 6249 65
+./cc0 $MODE 6 "8/8/8/8/8/7K/7P/7k w - - " 6249 66
+./cc0 $MODE 6 "K7/p7/k7/8/8/8/8/8 w - - " 2343 67
+./cc0 $MODE 6 "7K/7p/7k/8/8/8/8/8 w - - " 2343 68
+./cc0 $MODE 6 "8/2k1p3/3pP3/3P2K1/8/8/8/8 w - - " 34834 69
+./cc0 $MODE 6 "8/8/8/8/8/K7/P7/k7 b - - " 2343 70
+./cc0 $MODE 6 "8/8/8/8/8/7K/7P/7k b - - " 2343 71
+./cc0 $MODE 6 "K7/p7/k7/8/8/8/8/8 b - - " 6249 72
+./cc0 $MODE 6 "7K/7p/7k/8/8/8/8/8 b - - " 6249 73
+./cc0 $MODE 6 "8/2k1p3/3pP3/3P2K1/8/8/8/8 b - - " 34822 74
+./cc0 $MODE 6 "8/8/8/8/8/4k3/4P3/4K3 w - - " 11848 75
+./cc0 $MODE 6 "4k3/4p3/4K3/8/8/8/8/8 b - - " 11848 76
+./cc0 $MODE 6 "8/8/7k/7p/7P/7K/8/8 w - - " 10724 77
+./cc0 $MODE 6 "8/8/k7/p7/P7/K7/8/8 w - - " 10724 78
+./cc0 $MODE 6 "8/8/3k4/3p4/3P4/3K4/8/8 w - - " 53138 79
+./cc0 $MODE 6 "8/3k4/3p4/8/3P4/3K4/8/8 w - - " 157093 80
+./cc0 $MODE 6 "8/8/3k4/3p4/8/3P4/3K4/8 w - - " 158065 81
+./cc0 $MODE 6 "k7/8/3p4/8/3P4/8/8/7K w - - " 20960 82
+./cc0 $MODE 6 "8/8/7k/7p/7P/7K/8/8 b - - " 10724 83
+./cc0 $MODE 6 "8/8/k7/p7/P7/K7/8/8 b - - " 10724 84
+./cc0 $MODE 6 "8/8/3k4/3p4/3P4/3K4/8/8 b - - " 53138 85
+./cc0 $MODE 6 "8/3k4/3p4/8/3P4/3K4/8/8 b - - " 158065 86
+./cc0 $MODE 6 "8/8/3k4/3p4/8/3P4/3K4/8 b - - " 157093 87
+./cc0 $MODE 6 "k7/8/3p4/8/3P4/8/8/7K b - - " 21104 88
+./cc0 $MODE 6 "7k/3p4/8/8/3P4/8/8/K7 w - - " 32191 89
+./cc0 $MODE 6 "7k/8/8/3p4/8/8/3P4/K7 w - - " 30980 90
+./cc0 $MODE 6 "k7/8/8/7p/6P1/8/8/K7 w - - " 41874 91
+./cc0 $MODE 6 "k7/8/7p/8/8/6P1/8/K7 w - - " 29679 92
+./cc0 $MODE 6 "k7/8/8/6p1/7P/8/8/K7 w - - " 41874 93
+./cc0 $MODE 6 "k7/8/6p1/8/8/7P/8/K7 w - - " 29679 94
+./cc0 $MODE 6 "k7/8/8/3p4/4p3/8/8/7K w - - " 22886 95
+./cc0 $MODE 6 "k7/8/3p4/8/8/4P3/8/7K w - - " 28662 96
+./cc0 $MODE 6 "7k/3p4/8/8/3P4/8/8/K7 b - - " 32167 97
+./cc0 $MODE 6 "7k/8/8/3p4/8/8/3P4/K7 b - - " 30749 98
+./cc0 $MODE 6 "k7/8/8/7p/6P1/8/8/K7 b - - " 41874 99
+./cc0 $MODE 6 "k7/8/7p/8/8/6P1/8/K7 b - - " 29679 100
+./cc0 $MODE 6 "k7/8/8/6p1/7P/8/8/K7 b - - " 41874 101
+./cc0 $MODE 6 "k7/8/6p1/8/8/7P/8/K7 b - - " 29679 102
+./cc0 $MODE 6 "k7/8/8/3p4/4p3/8/8/7K b - - " 22579 103
+./cc0 $MODE 6 "k7/8/3p4/8/8/4P3/8/7K b - - " 28662 104
+./cc0 $MODE 6 "7k/8/8/p7/1P6/8/8/7K w - - " 41874 105
+./cc0 $MODE 6 "7k/8/p7/8/8/1P6/8/7K w - - " 29679 106
+./cc0 $MODE 6 "7k/8/8/1p6/P7/8/8/7K w - - " 41874 107
+./cc0 $MODE 6 "7k/8/1p6/8/8/P7/8/7K w - - " 29679 108
+./cc0 $MODE 6 "k7/7p/8/8/8/8/6P1/K7 w - - " 55338 109
+./cc0 $MODE 6 "k7/6p1/8/8/8/8/7P/K7 w - - " 55338 110
+./cc0 $MODE 6 "3k4/3pp3/8/8/8/8/3PP3/3K4 w - - " 199002 111
+./cc0 $MODE 6 "7k/8/8/p7/1P6/8/8/7K b - - " 41874 112
+./cc0 $MODE 6 "7k/8/p7/8/8/1P6/8/7K b - - " 29679 113
+./cc0 $MODE 6 "7k/8/8/1p6/P7/8/8/7K b - - " 41874 114
+./cc0 $MODE 6 "7k/8/1p6/8/8/P7/8/7K b - - " 29679 115
+./cc0 $MODE 6 "k7/7p/8/8/8/8/6P1/K7 b - - " 55338 116
+./cc0 $MODE 6 "k7/6p1/8/8/8/8/7P/K7 b - - " 55338 117
+./cc0 $MODE 6 "3k4/3pp3/8/8/8/8/3PP3/3K4 b - - " 199002 118
+./cc0 $MODE 6 "8/Pk6/8/8/8/8/6Kp/8 w - - " 1030499 119
+./cc0 $MODE 6 "n1n5/1Pk5/8/8/8/8/5Kp1/5N1N w - - " 37665329 120
+./cc0 $MODE 6 "8/PPPk4/8/8/8/8/4Kppp/8 w - - " 28859283 121
+./cc0 $MODE 6 "n1n5/PPPk4/8/8/8/8/4Kppp/5N1N w - - " 71179139 122
+./cc0 $MODE 6 "8/Pk6/8/8/8/8/6Kp/8 b - - " 1030499 123
+./cc0 $MODE 6 "n1n5/1Pk5/8/8/8/8/5Kp1/5N1N b - - " 37665329 124
+./cc0 $MODE 6 "8/PPPk4/8/8/8/8/4Kppp/8 b - - " 28859283 125
+./cc0 $MODE 6 "n1n5/PPPk4/8/8/8/8/4Kppp/5N1N b - - " 71179139 126
+./cc0 $MODE 6 "8/8/1k6/8/2pP4/8/5BK1/8 b - d3 " 824064 127
+./cc0 $MODE 6 "8/8/1k6/2b5/2pP4/8/5K2/8 b - d3 " 1440467 128
+./cc0 $MODE 6 "8/5k2/8/2Pp4/2B5/1K6/8/8 w - d6 " 1440467 129
+./cc0 $MODE 6 "5k2/8/8/8/8/8/8/4K2R w K - " 661072 130
+./cc0 $MODE 6 "4k2r/8/8/8/8/8/8/5K2 b k - " 661072 131
+./cc0 $MODE 6 "3k4/8/8/8/8/8/8/R3K3 w Q - " 803711 132
+./cc0 $MODE 6 "r3k3/8/8/8/8/8/8/3K4 b q - " 803711 133
+./cc0 $MODE 4 "r3k2r/1b4bq/8/8/8/8/7B/R3K2R w KQkq - " 1274206 134
+./cc0 $MODE 4 "r3k2r/7b/8/8/8/8/1B4BQ/R3K2R b KQkq - " 1274206 135
+./cc0 $MODE 4 "r3k2r/8/3Q4/8/8/5q2/8/R3K2R b KQkq - " 1720476 136
+./cc0 $MODE 4 "r3k2r/8/5Q2/8/8/3q4/8/R3K2R w KQkq - " 1720476 137
+./cc0 $MODE 6 "2K2r2/4P3/8/8/8/8/8/3k4 w - - " 3821001 138
+./cc0 $MODE 6 "3K4/8/8/8/8/8/4p3/2k2R2 b - - " 3821001 139
+./cc0 $MODE 5 "8/8/1P2K3/8/2n5/1q6/8/5k2 b - - " 1004658 140
+./cc0 $MODE 5 "5K2/8/1Q6/2N5/8/1p2k3/8/8 w - - " 1004658 141
+./cc0 $MODE 6 "4k3/1P6/8/8/8/8/K7/8 w - - " 217342 142
+./cc0 $MODE 6 "8/k7/8/8/8/8/1p6/4K3 b - - " 217342 143
+./cc0 $MODE 6 "8/P1k5/K7/8/8/8/8/8 w - - " 92683 144
+./cc0 $MODE 6 "8/8/8/8/8/k7/p1K5/8 b - - " 92683 145
+./cc0 $MODE 6 "K1k5/8/P7/8/8/8/8/8 w - - " 2217 146
+./cc0 $MODE 6 "8/8/8/8/8/p7/8/k1K5 b - - " 2217 147
+./cc0 $MODE 7 "8/k1P5/8/1K6/8/8/8/8 w - - " 567584 148
+./cc0 $MODE 7 "8/8/8/8/1k6/8/K1p5/8 b - - " 567584 149
+./cc0 $MODE 4 "8/8/2k5/5q2/5n2/8/5K2/8 b - - " 23527 150
+./cc0 $MODE 4 "8/5k2/8/5N2/5Q2/2K5/8/8 w - - " 23527 151
+./cc0 $MODE 5 "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - " 193690690 152
+./cc0 $MODE 6 "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - " 11030083 153
+./cc0 $MODE 5 "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - " 15833292 154
+./cc0 $MODE 3 "rnbqkb1r/pp1p1ppp/2p5/4P3/2B5/8/PPP1NnPP/RNBQK2R w KQkq - " 53392 155
+./cc0 $MODE 5 "r4rk1/1pp1qppp/p1np1n2/2b1p1B1/2B1P1b1/P1NP1N2/1PP1QPPP/R4RK1 w - - " 164075551 156
+./cc0 $MODE 7 "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - " 178633661 157
+./cc0 $MODE 6 "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - " 706045033 158
+./cc0 $MODE 5 "rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - " 89941194 159
+./cc0 $MODE 5 "1k6/1b6/8/8/7R/8/8/4K2R b K - " 1063513 160
+./cc0 $MODE 6 "3k4/3p4/8/K1P4r/8/8/8/8 b - - " 1134888 161
+./cc0 $MODE 6 "8/8/4k3/8/2p5/8/B2P2K1/8 w - - " 1015133 162
\ No newline at end of file
@@ -0,0 +1,298 @@
+#include "ChaosMagic.h"
+#include "Fen.h"
+#include "Search.h"
+#include "Notation.h"
+#include "Polyglot.h"
+#include <cstdio>
+#include <cstring>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+
+using std::string;
+using namespace Charon;
+
+void position(const char*);
+void go(const char*);
+void setOption(const char*);
+void stopSearch();
+void waitForSearch();
+void report(const Search::Iteration&);
+const char* after(const char*, const char*);
+
+/** The position set by the last position command. */
+Board* root = nullptr;
+
+/** The transposition table. */
+TranspositionTable* tt = nullptr;
+
+/** The opening book, or nullptr for none. */
+Polyglot::Book* book = nullptr;
+
+/** The generator of the book's choices. */
+uint64_t bookSeed = 0x9E3779B97F4A7C15ULL;
+
+/** The number of search threads. */
+int threads = 1;
+
+/** The search thread, while a search runs. */
+std::thread worker;
+
+/** The flag that stops a running search. */
+std::atomic<bool> stop(false);
+
+/** Whether or not a stop command came for this search. */
+std::atomic<bool> halted(false);
+
+/** A lock to keep lines from the two threads whole. */
+std::mutex io;
+
+/**
+ * A function to write a line to the GUI.
+ *
+ * @param line the line, without a newline
+ */
+void send(const char* const line) {
+    const std::lock_guard<std::mutex> lock(io);
+    printf("%s\n", line);
+    fflush(stdout);
+}
+
+int main() {
+    Witchcraft::init();
+    root = new Board(Board::Builder<Default>().build());
+    tt   = new TranspositionTable(64);
+    // This thread only reads commands, so stop and isready
+    // are answered at once, even while the worker searches.
+    string line;
+    while(std::getline(std::cin, line)) {
+        const char* const c = line.c_str();
+        if(!strcmp(c, "uci")) {
+            const std::lock_guard<std::mutex> lock(io);
+            printf("id name Charon\n"
+                   "id author Ellie Moore and agent\n"
+                   "option name Hash type spin default 64 min 1 max 65536\n"
+                   "option name Threads type spin default 1 min 1 max %d\n"
+                   "option name EvalFile type string default <empty>\n"
+                   "option name BookFile type string default <empty>\n"
+                   "uciok\n", Search::MaxThreads);
+            fflush(stdout);
+        }
+        else if(!strcmp(c, "isready")) send("readyok");
+        else if(!strncmp(c, "setoption ", 10)) setOption(c);
+        else if(!strcmp(c, "ucinewgame")) {
+            waitForSearch();
+            tt->clear();
+        }
+        else if(!strncmp(c, "position ", 9)) position(c + 9);
+        else if(!strcmp(c, "go") || !strncmp(c, "go ", 3)) go(c + 2);
+        else if(!strcmp(c, "stop")) stopSearch();
+        else if(!strcmp(c, "quit")) break;
+    }
+    stopSearch();
+    delete book;
+    delete tt;
+    delete root;
+    Nnue::unload();
+    Witchcraft::destroy();
+    return 0;
+}
+
+/**
+ * A function to find the text after a keyword in a command.
+ *
+ * @param c       the command
+ * @param keyword the keyword, such as "wtime"
+ * @return the text after the keyword and its space, or
+ * nullptr if the keyword is not a whole word of the command
+ */
+const char* after(const char* const c, const char* const keyword) {
+    const size_t n = strlen(keyword);
+    for(const char* p = strstr(c, keyword); p; p = strstr(p + 1, keyword))
+        if((p == c || p[-1] == ' ') && (p[n] == ' ' || !p[n]))
+            return p[n] ? p + n + 1 : p + n;
+    return nullptr;
+}
+
+/**
+ * A function to set up the position of a position command:
+ * startpos or fen, then any moves.
+ *
+ * @param c the command, after "position "
+ */
+void position(const char* const c) {
+    waitForSearch();
+    const bool fen = !strncmp(c, "fen ", 4);
+    // The previous position stays if the new one is not legal,
+    // so that a bad command cannot send the search into a
+    // position with no kings.
+    if(fen && !FenUtility::isLegal(c + 4)) {
+        send("info string invalid fen");
+        return;
+    }
+    Board* const b = fen ?
+        new Board(FenUtility::parseBoard(c + 4)) :
+        new Board(Board::Builder<Default>().build());
+    delete root;
+    root = b;
+    const char* m = after(c, "moves");
+    while(m && *m) {
+        // A game of any length fits on the State stack once
+        // the moves before each capture or pawn move are
+        // dropped. A game that goes longer than that without
+        // one is cut short, so that the search keeps its room.
+        if(root->getHalfmoveClock() >= MaxPly - 2 * Search::MaxDepth) {
+            char line[96];
+            sprintf(line, "info string moves cut after %d plies "
+                          "without a capture or pawn move",
+                    MaxPly - 2 * Search::MaxDepth);
+            send(line);
+            break;
+        }
+        const Move move = Notation::fromUci(*root, m);
+        if(move == NullMove) {
+            const char* e = m;
+            for(; *e && *e != ' '; ++e);
+            const string line = "info string illegal move ";
+            send((line + string(m, e)).c_str());
+            break;
+        }
+        root->applyMove(move);
+        root->rebase();
+        for(; *m && *m != ' '; ++m);
+        for(; *m == ' '; ++m);
+    }
+}
+
+/**
+ * A function to start a search on the worker thread.
+ *
+ * @param c the command, after "go"
+ */
+void go(const char* const c) {
+    waitForSearch();
+    Search::Limits limits;
+    limits.threads = threads;
+    const char* v;
+    if((v = after(c, "wtime")))     limits.time[White] = atoll(v);
+    if((v = after(c, "btime")))     limits.time[Black] = atoll(v);
+    if((v = after(c, "winc")))      limits.inc[White]  = atoll(v);
+    if((v = after(c, "binc")))      limits.inc[Black]  = atoll(v);
+    if((v = after(c, "movestogo"))) limits.movesToGo   = atoi(v);
+    if((v = after(c, "movetime")))  limits.moveTime    = atoll(v);
+    if((v = after(c, "nodes")))     limits.nodes       = strtoull(v, nullptr, 10);
+    if((v = after(c, "depth")))
+        limits.depth = std::clamp(atoi(v), 1, Search::MaxDepth - 1);
+    // An infinite search must not answer before it is told
+    // to stop, even if it runs out of depth.
+    const bool infinite = after(c, "infinite") != nullptr;
+    // A book move is answered at once, unless the search is
+    // to run until it is stopped.
+    const Move bookMove = book && !infinite ?
+        book->choose(*root, bookSeed) : NullMove;
+    if(bookMove != NullMove) {
+        char line[32] = "bestmove ";
+        Notation::toUci(bookMove, line + 9);
+        send(line);
+        return;
+    }
+    stop.store(false);
+    halted.store(false);
+    worker = std::thread([limits, infinite] {
+        const Move best =
+            Search::think(*root, *tt, limits, report, stop);
+        while(infinite && !halted.load())
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        char line[32] = "bestmove ";
+        Notation::toUci(best, line + 9);
+        send(line);
+    });
+}
+
+/**
+ * A function to apply a setoption command.
+ *
+ * @param c the command
+ */
+void setOption(const char* const c) {
+    waitForSearch();
+    const char* const v = after(c, "value");
+    if(!v) return;
+    if(strstr(c, "name Hash ")) {
+        const int megabytes = atoi(v);
+        if(megabytes <= 0) return;
+        delete tt;
+        tt = new TranspositionTable(megabytes);
+    }
+    else if(strstr(c, "name Threads "))
+        threads = std::clamp(atoi(v), 1, Search::MaxThreads);
+    else if(strstr(c, "name EvalFile ")) {
+        // Without a network, Board::evaluate scores positions.
+        if(!strcmp(v, "<empty>")) Nnue::unload();
+        else if(!Nnue::load(v)) {
+            string line = "info string could not load ";
+            send((line + v).c_str());
+        }
+    }
+    else if(strstr(c, "name BookFile ")) {
+        delete book;
+        book = nullptr;
+        if(!strcmp(v, "<empty>")) return;
+        // The book is mapped, not read, so a large one costs
+        // nothing until it is probed. The keys are checked
+        // against the specification before the first probe.
+        if(!Polyglot::selfTest()) {
+            send("info string the Polyglot keys fail their self-test");
+            return;
+        }
+        book = new Polyglot::Book(v);
+        if(!book->isOpen()) {
+            delete book;
+            book = nullptr;
+            string line = "info string could not load ";
+            send((line + v).c_str());
+        }
+    }
+}
+
+/**
+ * A function to stop a running search and wait for its
+ * best move to be sent.
+ */
+void stopSearch() {
+    halted.store(true);
+    stop.store(true);
+    waitForSearch();
+}
+
+/**
+ * A function to wait for a running search to finish.
+ */
+void waitForSearch() {
+    if(worker.joinable()) worker.join();
+}
+
+void report(const Search::Iteration& it) {
+    const int s = it.score;
+    const uint64_t ms = (uint64_t) (it.seconds * 1000);
+    char line[8192];
+    int n = s > Search::MateBound ?
+        sprintf(line, "info depth %d score mate %d", it.depth,
+                (Search::MateValue - s + 1) / 2) :
+            s < -Search::MateBound ?
+        sprintf(line, "info depth %d score mate %d", it.depth,
+                -(Search::MateValue + s) / 2) :
+        sprintf(line, "info depth %d score cp %d", it.depth, s);
+    n += sprintf(line + n, " nodes %lu nps %lu time %lu pv",
+                 it.totalNodes,
+                 (uint64_t) (it.seconds > 0 ? it.totalNodes / it.seconds : 0),
+                 ms);
+    for(int i = 0; i < it.pvLength; ++i) {
+        line[n++] = ' ';
+        Notation::toUci(it.pv[i], line + n);
+        n += (int) strlen(line + n);
+    }
+    send(line);
+}